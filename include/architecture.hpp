@@ -9,6 +9,8 @@ namespace architecture {
 
 constexpr int number_of_cores = 4;
 constexpr int svc_exception_code = 0b10101;
+constexpr int lower_exception_level_instruction_abort_exception_code = 0b100000;
+constexpr int lower_exception_level_data_abort_exception_code = 0b100100;
 
 union cntv_ctl_el0 {
     struct {
@@ -3,24 +3,37 @@
 
 #include "../lib/array.hpp"
 #include "../lib/span.hpp"
+#include "architecture.hpp"
 #include "integer.hpp"
 #include "memory.hpp"
+#include "page_table.hpp"
 #include "reinterpretable.hpp"
 #include "spin_lock.hpp"
 #include "symbols.hpp"
 
 namespace memory {
 
-enum class page_state_t { unallocated, allocated, subordinate };
+enum class page_state_t : uint8_t { subordinate, unallocated, allocated };
 
 struct page_metadata_t {
+    int32_t reference_count;
+    int8_t order;
     page_state_t state;
-    int order;
+};
+static_assert(sizeof(page_metadata_t) == sizeof(uint64_t));
+
+// Stored in the first page of every block on a free list
+struct free_block_t {
     uint64_t previous;
     uint64_t next;
 };
 
-using page_t = array_t<byte_t, page_size>;
+// Freed blocks are pushed at the hot end and popped from it; refills enter at the cold end, which is drained first
+struct page_cache_t {
+    array_t<uint64_t, buddy_allocator_constants::page_cache_capacity> indices;
+    size_t head = 0;
+    size_t number_of_blocks = 0;
+};
 
 class buddy_allocator {
 public:
@@ -33,12 +46,24 @@ public:
     static auto print_state() -> void;
 
     auto allocate(int order) -> span_t<byte_t>;
+    auto allocate_if_available(int order) -> span_t<byte_t>;
+    auto allocate_zeroed(int order) -> span_t<byte_t>;
     auto deallocate(void *address) -> void;
+    auto split(void *address) -> void;
+    auto reference(void *address) -> void;
+    auto get_reference_count(void *address) -> int;
+    auto contains(const void *address) -> bool;
+    auto get_number_of_free_pages() -> size_t;
+    auto handle_page_zeroing() -> void;
 
     template <typename T> auto allocate(int order) -> T * {
         return reinterpretable_t<span_t<byte_t>>(this->allocate(order)).to<T>();
     }
 
+    template <typename T> auto allocate_zeroed(int order) -> T * {
+        return reinterpretable_t<span_t<byte_t>>(this->allocate_zeroed(order)).to<T>();
+    }
+
     buddy_allocator(const buddy_allocator &) = delete;
     auto operator=(const buddy_allocator &) -> buddy_allocator & = delete;
     buddy_allocator(buddy_allocator &&) = delete;
@@ -46,25 +71,41 @@ public:
 
 private:
     static constexpr auto hardware_maximum_number_of_pages =
-        kernel_address_space_constants::physical_address_space_size / (page_size + sizeof(page_metadata_t));
+        kernel_address_space_constants::maximum_physical_address_space_size / (page_size + sizeof(page_metadata_t));
 
     synchronization::spin_lock lock;
     size_t number_of_pages = 0;
     array_t<page_metadata_t, hardware_maximum_number_of_pages> *page_metadata_list = nullptr;
     array_t<page_t, hardware_maximum_number_of_pages> *pages_base_address = nullptr;
     array_t<uint64_t, buddy_allocator_constants::maximum_order> free_lists = {};
+    uint64_t non_empty_orders = 0;
+    size_t number_of_free_pages = 0;
+    array_t<array_t<page_cache_t, buddy_allocator_constants::maximum_cached_order + 1>, architecture::number_of_cores>
+        page_caches{};
+    synchronization::spin_lock zeroed_pages_lock;
+    array_t<uint64_t, buddy_allocator_constants::zeroed_pool_capacity> zeroed_pages{};
+    size_t number_of_zeroed_pages = 0;
 
     void set_page_state(uint64_t index, page_state_t state);
     void set_page_order(uint64_t index, int order);
-    void set_page_previous(uint64_t index, uint64_t previous);
-    void set_page_next(uint64_t index, uint64_t next);
+    auto get_free_block(uint64_t index) -> free_block_t &;
     void remove_from_free_list(uint64_t index, int order);
     void insert_into_free_list(uint64_t index, int order);
+    auto get_page_index(const void *address) -> uint64_t;
+    auto allocate_from_free_lists(int order) -> span_t<byte_t>;
+    auto allocate_block(int order) -> uint64_t;
+    auto deallocate_block(uint64_t index) -> void;
+    auto refill_page_cache(page_cache_t &page_cache, int order) -> void;
+    auto drain_page_cache(page_cache_t &page_cache) -> void;
+    auto take_zeroed_page() -> uint64_t;
+    auto refill_zeroed_pages() -> void;
 
     buddy_allocator() = default;
     ~buddy_allocator() = default;
 };
 
+auto zero_pages(span_t<byte_t> pages) -> void;
+
 } // namespace memory
 
 #endif
@@ -4,21 +4,28 @@
 #include "../lib/array.hpp"
 #include "../lib/span.hpp"
 #include "block_cache.hpp"
+#include "external_types.hpp"
 #include "file.hpp"
 #include "inode_cache.hpp"
+#include "page_cache.hpp"
 #include "pipe_interface.hpp"
+#include "ring_interface.hpp"
+#include "shared_memory_interface.hpp"
 #include "sleep_lock.hpp"
 #include "spin_lock.hpp"
+#include "synchronization.hpp"
 
 #include <cstddef>
 #include <cstdint>
 
 namespace file {
 
-enum class file_descriptor_type_t { unused, inode, pipe, input, output, socket };
+enum class file_descriptor_type_t { unused, inode, pipe, input, output, socket, event_set, ring, shared_memory };
 
 enum class open_mode_t { do_not_create, create_directory, create_file };
 
+enum class event_set_operation_t { add = 1, modify = 2, remove = 3 };
+
 struct file_descriptor_status_t {
     file_descriptor_type_t file_descriptor_type;
     file::inode_type_t inode_type;
@@ -31,11 +38,27 @@ struct file_descriptor_t {
     file_descriptor_type_t type;
     bool readable;
     bool writable;
+    bool non_blocking;
     inode_index_t index_of_inode_on_disk;
     size_t read_offset;
     size_t write_offset;
     int pipe_index;
     int socket_index;
+    int event_set_index;
+    int ring_index;
+    int shared_memory_index;
+};
+
+struct event_set_entry_t {
+    int file_descriptor_index = -1;
+    uint16_t requested_events = 0;
+    uint16_t last_events = 0;
+};
+
+struct event_set_t {
+    int reference_count = 0;
+    array_t<event_set_entry_t, descriptor_interface_constants::maximum_number_of_file_descriptors_per_process> entries =
+        {};
 };
 
 struct file_descriptor_table_t {
@@ -54,11 +77,16 @@ public:
     auto initialize_file_descriptors(uint64_t process_id) -> void;
     auto remove_file_descriptors(uint64_t process_id) -> void;
     auto clone_file_descriptors(int from_process_id, int to_process_id) -> void;
+    auto clone_file_descriptors(int from_process_id, int to_process_id, span_t<int32_t> file_descriptor_map) -> bool;
 
     auto open(uint64_t process_id, path_name_t path, bool readable, bool writable, open_mode_t mode) -> int;
     auto close(uint64_t process_id, uint64_t file_descriptor_index) -> void;
     auto read(uint64_t process_id, uint64_t file_descriptor_index, span_t<byte_t> buffer) -> size_t;
     auto write(uint64_t process_id, uint64_t file_descriptor_index, span_t<byte_t> buffer) -> size_t;
+    auto read_at(uint64_t process_id, uint64_t file_descriptor_index, size_t offset, span_t<byte_t> buffer) -> size_t;
+    auto write_at(uint64_t process_id, uint64_t file_descriptor_index, size_t offset, span_t<byte_t> buffer) -> size_t;
+    auto read_vector(uint64_t process_id, uint64_t file_descriptor_index, span_t<span_t<byte_t>> buffers) -> size_t;
+    auto write_vector(uint64_t process_id, uint64_t file_descriptor_index, span_t<span_t<byte_t>> buffers) -> size_t;
 
     auto seek(uint64_t process_id, uint64_t file_descriptor_index, bool read, size_t new_read_offset, bool write,
               size_t new_write_offset) -> void;
@@ -81,7 +109,49 @@ public:
     auto transmit(uint64_t file_descriptor_index, span_t<byte_t> buffer,
                   networking::internet_protocol_address_t internet_protocol_address,
                   networking::port_number_t port_number) -> size_t;
+    auto send_file(uint64_t process_id, uint64_t output_file_descriptor_index, uint64_t input_file_descriptor_index,
+                   size_t offset, size_t size) -> size_t;
+    auto splice(uint64_t process_id, uint64_t input_file_descriptor_index, uint64_t output_file_descriptor_index,
+                size_t size) -> size_t;
+    auto tee(uint64_t process_id, uint64_t input_file_descriptor_index, uint64_t output_file_descriptor_index,
+             size_t size) -> size_t;
     auto pipe(array_t<int32_t, 2> *file_descriptors) -> bool;
+    auto resize_pipe(uint64_t process_id, uint64_t file_descriptor_index, size_t new_capacity) -> size_t;
+    auto set_non_blocking(uint64_t process_id, uint64_t file_descriptor_index, bool non_blocking) -> bool;
+
+    auto poll(uint64_t process_id, span_t<poll_descriptor_t> poll_descriptors, bool blocking) -> size_t;
+    auto create_event_set(uint64_t process_id) -> int;
+    auto control_event_set(uint64_t process_id, uint64_t event_set_file_descriptor_index,
+                           uint64_t file_descriptor_index, event_set_operation_t operation, uint16_t events) -> bool;
+    auto wait_event_set(uint64_t process_id, uint64_t event_set_file_descriptor_index,
+                        span_t<poll_descriptor_t> poll_descriptors, bool blocking) -> size_t;
+
+    auto create_ring(uint64_t process_id, memory::page_table_t *level_0_page_table, uint32_t flags,
+                     uintptr_t *user_address_address) -> int;
+    auto enter_ring(uint64_t process_id, uint64_t ring_file_descriptor_index, size_t minimum_number_of_completions)
+        -> size_t;
+    auto close_rings(uint64_t process_id) -> void;
+    auto handle_ring_operations() -> void;
+    auto execute_ring_entry(uint64_t process_id, ring_operation_t operation, int file_descriptor_index,
+                            span_t<byte_t> buffer, size_t offset, void **condition_address) -> int64_t;
+    auto synchronize(uint64_t process_id, uint64_t file_descriptor_index) -> bool;
+
+    auto reference_inode(uint64_t process_id, uint64_t file_descriptor_index) -> inode_index_t;
+    auto reference_inode(inode_index_t index_of_inode_on_disk) -> void;
+    auto release_inode(inode_index_t index_of_inode_on_disk) -> void;
+    auto read_inode(inode_index_t index_of_inode_on_disk, size_t offset, span_t<byte_t> buffer) -> size_t;
+    auto acquire_mapped_page(inode_index_t index_of_inode_on_disk, size_t page_index) -> memory::page_t *;
+    auto mark_mapped_page_dirty(inode_index_t index_of_inode_on_disk, size_t page_index) -> void;
+    auto synchronize_mapped_pages(inode_index_t index_of_inode_on_disk, size_t first_page_index,
+                                  size_t number_of_pages) -> void;
+
+    auto create_shared_memory(uint64_t process_id, size_t size) -> int;
+    auto reference_shared_memory(uint64_t process_id, uint64_t file_descriptor_index) -> int;
+    auto reference_shared_memory(int shared_memory_index) -> void;
+    auto release_shared_memory(int shared_memory_index) -> void;
+    auto map_shared_memory(int shared_memory_index, memory::page_table_t *level_0_page_table,
+                           uintptr_t virtual_address, memory::page_table_t::type_t type, size_t first_page_index,
+                           size_t number_of_pages) -> void;
 
     auto recover() -> void;
 
@@ -93,16 +163,38 @@ public:
 private:
     file::block_cache_t block_cache;
     file::inode_cache_t inode_cache{&block_cache};
+    file::page_cache_t page_cache{&block_cache, &inode_cache};
     process::pipe_interface pipes;
+    ring_interface rings;
+    shared_memory_interface shared_memory_objects;
     synchronization::sleep_lock directory_lock;
     array_t<file_descriptor_table_t, process::thread_scheduler_constants::maximum_number_of_processes>
         file_descriptors{};
+    array_t<event_set_t, descriptor_interface_constants::maximum_number_of_event_sets> event_sets{};
+    synchronization::spin_lock event_set_lock;
     synchronization::spin_lock lock;
     bool initialized = false;
 
     synchronization::sleep_lock test_lock;
     int number_of_completed_tests = 0;
 
+    auto read_vector(uint64_t process_id, uint64_t file_descriptor_index, span_t<span_t<byte_t>> buffers,
+                     bool may_block) -> size_t;
+    auto write_vector(uint64_t process_id, uint64_t file_descriptor_index, span_t<span_t<byte_t>> buffers,
+                      bool may_block) -> size_t;
+    auto accept(uint64_t process_id, uint64_t file_descriptor_index, bool may_block) -> int;
+    auto read_inode(inode_index_t index_of_inode_on_disk, size_t offset, span_t<span_t<byte_t>> buffers) -> size_t;
+    auto write_inode(inode_index_t index_of_inode_on_disk, size_t offset, span_t<span_t<byte_t>> buffers) -> size_t;
+    auto reference_file_descriptor(file_descriptor_t &file_descriptor) -> void;
+    auto get_readiness(file_descriptor_t &file_descriptor) -> synchronization::readiness_t;
+    auto poll_file_descriptors(uint64_t process_id, span_t<poll_descriptor_t> poll_descriptors,
+                               span_t<void *> conditions) -> size_t;
+    auto poll_event_set(uint64_t process_id, int event_set_index, span_t<poll_descriptor_t> poll_descriptors,
+                        span_t<void *> conditions) -> size_t;
+    auto reference_event_set(int event_set_index) -> void;
+    auto dereference_event_set(int event_set_index) -> void;
+    auto remove_from_event_sets(uint64_t process_id, uint64_t file_descriptor_index) -> void;
+
     void print_directory_tree(uint32_t index_of_inode_on_disk, int level);
     void print_state();
 
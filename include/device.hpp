@@ -39,6 +39,17 @@ constexpr uint64_t virtio_blk_block_size = 1024;
 constexpr uint64_t virtio_blk_sector_size = 512;
 constexpr uint64_t virtio_blk_virtqueue_ring_size = 8;
 
+constexpr uint32_t device_tree_magic = 0xd00dfeed;
+constexpr uint32_t device_tree_begin_node_token = 0x1;
+constexpr uint32_t device_tree_end_node_token = 0x2;
+constexpr uint32_t device_tree_property_token = 0x3;
+constexpr uint32_t device_tree_nop_token = 0x4;
+constexpr uint32_t device_tree_end_token = 0x9;
+constexpr size_t device_tree_window_size = memory::section_size;
+constexpr uint32_t device_tree_default_address_cells = 2;
+constexpr uint32_t device_tree_default_size_cells = 1;
+constexpr uint32_t device_tree_maximum_number_of_cells = 2;
+
 enum class virtio_request_type { read, write };
 enum class virtqueue_descriptor_flag { none, next, write, read, indirect };
 
@@ -0,0 +1,41 @@
+#ifndef DEVICE_TREE_HPP
+#define DEVICE_TREE_HPP
+
+#include "device.hpp"
+#include "integer.hpp"
+#include "memory.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace device {
+
+class device_tree {
+public:
+    static auto get() -> device_tree & {
+        static device_tree instance;
+        return instance;
+    }
+
+    static auto initialize() -> void;
+    static auto get_physical_address() -> uintptr_t;
+
+    [[nodiscard]] auto get_memory_size() const -> size_t;
+
+    device_tree(const device_tree &) = delete;
+    auto operator=(const device_tree &) -> device_tree & = delete;
+    device_tree(device_tree &&) = delete;
+    auto operator=(device_tree &&) -> device_tree & = delete;
+
+private:
+    size_t memory_size = memory::kernel_address_space_constants::minimum_physical_address_space_size;
+
+    static auto find_memory_size(const byte_t *blob) -> size_t;
+
+    device_tree() = default;
+    ~device_tree() = default;
+};
+
+} // namespace device
+
+#endif
@@ -155,6 +155,9 @@ public:
     [[nodiscard]] auto is_loadable() const -> bool {
         return this->type == 1;
     }
+    [[nodiscard]] auto is_writable() const -> bool {
+        return (this->flags & 0x2) != 0;
+    }
     [[nodiscard]] auto get_off_field() const -> size_t {
         return this->off;
     }
@@ -174,6 +177,136 @@ public:
 constexpr size_t elf_section_header_size = 56;
 static_assert(sizeof(elf_section_header_t) == elf_section_header_size);
 
+class input_output_vector_t {
+private:
+    uint64_t address;
+    uint64_t size;
+
+public:
+    [[nodiscard]] auto get_address_field() const -> uintptr_t {
+        return this->address;
+    }
+    [[nodiscard]] auto get_size_field() const -> size_t {
+        return this->size;
+    }
+};
+constexpr size_t input_output_vector_size = 16;
+static_assert(sizeof(input_output_vector_t) == input_output_vector_size);
+
+class poll_descriptor_t {
+private:
+    int32_t file_descriptor;
+    uint16_t requested_events;
+    uint16_t returned_events;
+
+public:
+    [[nodiscard]] auto get_file_descriptor_field() const -> int32_t {
+        return this->file_descriptor;
+    }
+    auto set_file_descriptor_field(int32_t value) -> void {
+        this->file_descriptor = value;
+    }
+    [[nodiscard]] auto get_requested_events_field() const -> uint16_t {
+        return this->requested_events;
+    }
+    auto set_requested_events_field(uint16_t value) -> void {
+        this->requested_events = value;
+    }
+    auto set_returned_events_field(uint16_t value) -> void {
+        this->returned_events = value;
+    }
+};
+constexpr size_t poll_descriptor_size = 8;
+static_assert(sizeof(poll_descriptor_t) == poll_descriptor_size);
+
+class ring_header_t {
+private:
+    uint32_t submission_head;
+    uint32_t submission_tail;
+    uint32_t completion_head;
+    uint32_t completion_tail;
+    uint32_t number_of_entries;
+    uint32_t flags;
+    uint64_t reserved;
+
+public:
+    [[nodiscard]] auto get_submission_head_field() const -> uint32_t {
+        return __atomic_load_n(&this->submission_head, __ATOMIC_ACQUIRE);
+    }
+    auto set_submission_head_field(uint32_t value) -> void {
+        __atomic_store_n(&this->submission_head, value, __ATOMIC_RELEASE);
+    }
+    [[nodiscard]] auto get_submission_tail_field() const -> uint32_t {
+        return __atomic_load_n(&this->submission_tail, __ATOMIC_ACQUIRE);
+    }
+    [[nodiscard]] auto get_completion_head_field() const -> uint32_t {
+        return __atomic_load_n(&this->completion_head, __ATOMIC_ACQUIRE);
+    }
+    [[nodiscard]] auto get_completion_tail_field() const -> uint32_t {
+        return __atomic_load_n(&this->completion_tail, __ATOMIC_ACQUIRE);
+    }
+    auto set_completion_tail_field(uint32_t value) -> void {
+        __atomic_store_n(&this->completion_tail, value, __ATOMIC_RELEASE);
+    }
+    auto set_number_of_entries_field(uint32_t value) -> void {
+        this->number_of_entries = value;
+    }
+    auto set_flags_field(uint32_t value) -> void {
+        this->flags = value;
+    }
+};
+constexpr size_t ring_header_size = 32;
+static_assert(sizeof(ring_header_t) == ring_header_size);
+
+class submission_entry_t {
+private:
+    uint8_t operation;
+    array_t<uint8_t, 3> reserved;
+    int32_t file_descriptor;
+    uint64_t address;
+    uint64_t size;
+    uint64_t offset;
+    uint64_t user_data;
+
+public:
+    [[nodiscard]] auto get_operation_field() const -> uint8_t {
+        return this->operation;
+    }
+    [[nodiscard]] auto get_file_descriptor_field() const -> int32_t {
+        return this->file_descriptor;
+    }
+    [[nodiscard]] auto get_address_field() const -> uint64_t {
+        return this->address;
+    }
+    [[nodiscard]] auto get_size_field() const -> uint64_t {
+        return this->size;
+    }
+    [[nodiscard]] auto get_offset_field() const -> uint64_t {
+        return this->offset;
+    }
+    [[nodiscard]] auto get_user_data_field() const -> uint64_t {
+        return this->user_data;
+    }
+};
+constexpr size_t submission_entry_size = 40;
+static_assert(sizeof(submission_entry_t) == submission_entry_size);
+
+class completion_entry_t {
+private:
+    uint64_t user_data;
+    int64_t result;
+
+public:
+    auto set_user_data_field(uint64_t value) -> void {
+        this->user_data = value;
+    }
+    auto set_result_field(int64_t value) -> void {
+        this->result = value;
+    }
+};
+constexpr size_t completion_entry_size = 16;
+static_assert(sizeof(completion_entry_t) == completion_entry_size);
+
 class context {
 private:
     void *sp{};
@@ -861,4 +994,52 @@ public:
 constexpr size_t user_datagram_protocol_header_size = 8;
 static_assert(sizeof(user_datagram_protocol_header_t) == user_datagram_protocol_header_size);
 
+class device_tree_header_t {
+private:
+    uint32_t magic{};
+    uint32_t total_size{};
+    uint32_t structure_offset{};
+    uint32_t strings_offset{};
+    uint32_t memory_reservation_map_offset{};
+    uint32_t version{};
+    uint32_t last_compatible_version{};
+    uint32_t boot_cpu_id{};
+    uint32_t strings_size{};
+    uint32_t structure_size{};
+
+public:
+    [[nodiscard]] auto get_magic_field() const -> uint32_t {
+        auto value = this->magic;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+    [[nodiscard]] auto get_total_size_field() const -> size_t {
+        auto value = this->total_size;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+    [[nodiscard]] auto get_structure_offset_field() const -> size_t {
+        auto value = this->structure_offset;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+    [[nodiscard]] auto get_strings_offset_field() const -> size_t {
+        auto value = this->strings_offset;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+    [[nodiscard]] auto get_strings_size_field() const -> size_t {
+        auto value = this->strings_size;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+    [[nodiscard]] auto get_structure_size_field() const -> size_t {
+        auto value = this->structure_size;
+        reverse_byte_order(as_writable_bytes(span_t(&value, 1)));
+        return value;
+    }
+};
+constexpr size_t device_tree_header_size = 40;
+static_assert(sizeof(device_tree_header_t) == device_tree_header_size);
+
 #endif
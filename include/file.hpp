@@ -61,9 +61,29 @@ namespace inode_cache_constants {
     constexpr size_t cache_size = 64;
 } // namespace inode_cache_constants
 
+namespace page_cache_constants {
+    constexpr size_t cache_size = 256;
+} // namespace page_cache_constants
+
 namespace descriptor_interface_constants {
     constexpr int maximum_number_of_file_descriptors_per_process = 32;
     constexpr int maximum_number_of_changed_blocks_per_transaction = 8;
+    constexpr int maximum_number_of_data_blocks_per_write_transaction = 8;
+    constexpr size_t maximum_number_of_input_output_vectors = 16;
+    constexpr size_t send_file_buffer_order = 2;
+    constexpr size_t splice_buffer_order = 0;
+    constexpr int maximum_number_of_event_sets = 16;
+    constexpr uint16_t readable_event = 0x1;
+    constexpr uint16_t writable_event = 0x2;
+    constexpr uint16_t closed_event = 0x4;
+    constexpr uint16_t invalid_event = 0x8;
+    constexpr uint16_t edge_triggered_event = 0x100;
+    constexpr int maximum_number_of_rings = 8;
+    constexpr int ring_order = 2;
+    constexpr size_t number_of_ring_entries = 256;
+    constexpr uint32_t polling_ring = 0x1;
+    constexpr int maximum_number_of_shared_memory_objects = 8;
+    constexpr size_t maximum_number_of_shared_memory_pages = 512;
 } // namespace descriptor_interface_constants
 
 } // namespace file
@@ -0,0 +1,46 @@
+#ifndef KERNEL_ALLOCATOR_HPP
+#define KERNEL_ALLOCATOR_HPP
+
+#include "../lib/array.hpp"
+#include "integer.hpp"
+#include "memory.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace memory {
+
+// Precedes every allocation; allocations too large for a size class use size_class == number_of_size_classes
+struct kernel_allocation_header_t {
+    uint32_t size_class;
+    uint32_t order;
+    uint64_t size;
+};
+static_assert(sizeof(kernel_allocation_header_t) == 2 * sizeof(uint64_t));
+
+template <size_t size> struct kernel_allocation_block_t {
+    array_t<byte_t, size> bytes;
+};
+
+struct kernel_allocator_statistics_t {
+    size_t number_of_allocations = 0;
+    size_t number_of_deallocations = 0;
+    size_t number_of_bytes_requested = 0;
+};
+
+constexpr auto get_size_of_size_class(int size_class) -> size_t {
+    return static_cast<size_t>(1) << (kernel_allocator_constants::minimum_size_class_order + size_class);
+}
+
+auto kmalloc(size_t size) -> void *;
+auto kfree(void *address) -> void;
+auto get_kernel_allocator_statistics(int size_class) -> kernel_allocator_statistics_t;
+auto print_kernel_allocator_statistics() -> void;
+
+template <typename T> auto kmalloc(size_t number_of_elements) -> T * {
+    return static_cast<T *>(kmalloc(number_of_elements * sizeof(T)));
+}
+
+} // namespace memory
+
+#endif
@@ -8,6 +8,7 @@ namespace memory {
 
 constexpr size_t page_size = 0x1000ULL;
 constexpr size_t section_size = 0x200000ULL;
+constexpr size_t contiguous_range_size = 0x10000ULL;
 
 constexpr uintptr_t virtual_address_mask = 0xffff'0000'0000'0000;
 constexpr uintptr_t physical_address_mask = 0x0000'ffff'ffff'ffff;
@@ -16,7 +17,8 @@ namespace kernel_address_space_constants {
     constexpr uintptr_t virtual_address_begin = 0xffff000000000000ULL;
     constexpr size_t virtual_address_space_size = 1ULL << 38;
     constexpr uintptr_t physical_address_begin = 0x40000000ULL;
-    constexpr size_t physical_address_space_size = 1ULL << 26;
+    constexpr size_t minimum_physical_address_space_size = 1ULL << 26;
+    constexpr size_t maximum_physical_address_space_size = 3ULL << 30;
     constexpr uintptr_t link_address = virtual_address_begin + physical_address_begin;
     constexpr uintptr_t gicv3_distributor_begin = virtual_address_begin + 0x08000000ULL;
     constexpr size_t gicv3_distributor_size = 0x10000;
@@ -31,7 +33,7 @@ namespace kernel_address_space_constants {
     constexpr uintptr_t pcie_ecam_begin = virtual_address_begin + 0x3f000000ULL;
     constexpr size_t pcie_ecam_size = 0x10000000;
     constexpr int stack_size_order = 3;
-    constexpr size_t address_space_size = physical_address_space_size + gicv3_distributor_size +
+    constexpr size_t address_space_size = minimum_physical_address_space_size + gicv3_distributor_size +
                                           gicv3_redistributor_size + pl011_size + virtio_size + e1000_size +
                                           pcie_ecam_size;
     constexpr size_t stack_size = page_size * (0x1 << stack_size_order);
@@ -44,6 +46,9 @@ namespace user_address_space_constants {
     constexpr uintptr_t stack_top = 0x0001'0000'0000'0000;
     constexpr uintptr_t stack_begin = stack_top - stack_size;
     constexpr uintptr_t stack_end = stack_top;
+    constexpr uintptr_t mapping_begin = 0x0000'1000'0000'0000;
+    constexpr uintptr_t mapping_end = 0x0000'8000'0000'0000;
+    constexpr uintptr_t ring_begin = 0x0000'8000'0000'0000;
 } // namespace user_address_space_constants
 
 // TODO: Relocate these to constants in the new virtual_address_t and physical_address_t classes
@@ -61,16 +66,34 @@ namespace virtual_memory_constants {
         constexpr uint64_t level_3_page_table_index = 0b111'111'111;
         constexpr uint64_t physical_address_lower_bits = 0b111'111'111'111;
     } // namespace virtual_address_field_mask
+    constexpr size_t number_of_address_space_identifiers = 256;
+    constexpr uint64_t address_space_identifier_offset = 48;
+    constexpr uint64_t translation_lookaside_buffer_page_mask = 0x0000'0fff'ffff'ffff;
 } // namespace virtual_memory_constants
 
 namespace buddy_allocator_constants {
     constexpr int maximum_order = 64;
+    constexpr int section_order = 9;
+    constexpr int maximum_cached_order = 1;
+    constexpr size_t page_cache_capacity = 32;
+    constexpr size_t page_cache_batch_size = 8;
+    constexpr size_t zeroed_pool_capacity = 128;
+    constexpr uint64_t data_cache_zero_prohibited_bit = 0x10;
+    constexpr uint64_t data_cache_zero_block_size_mask = 0xf;
 }
 
 namespace slab_allocator_constants {
     constexpr int number_of_partially_allocated_slab_lists = 8;
+    constexpr int minimum_number_of_objects_per_slab = 8;
+    constexpr int maximum_slab_order = 4;
+    constexpr size_t magazine_capacity = 16;
 } // namespace slab_allocator_constants
 
+namespace kernel_allocator_constants {
+    constexpr int number_of_size_classes = 7;
+    constexpr int minimum_size_class_order = 5;
+} // namespace kernel_allocator_constants
+
 template <typename T> struct object_t;
 template <typename T> struct slab_t;
 
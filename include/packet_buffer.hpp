@@ -7,6 +7,7 @@
 #include "integer.hpp"
 #include "memory.hpp"
 #include "networking.hpp"
+#include "slab_allocator.hpp"
 #include "spin_lock.hpp"
 
 #include <cstddef>
@@ -17,11 +18,14 @@ namespace networking {
 
 class packet_buffer_t {
 public:
-    static auto allocate() -> packet_buffer_t * {
-        auto *packet_buffer = memory::buddy_allocator::get().allocate<packet_buffer_t>(1);
+    static auto construct(packet_buffer_t *packet_buffer) -> void {
         for (size_t offset = 0; offset < packet_buffer_constants::packet_buffer_size; offset++) {
             packet_buffer->buffer[offset].set_value(0);
         }
+    }
+
+    static auto allocate() -> packet_buffer_t * {
+        auto *packet_buffer = memory::slab_allocator<packet_buffer_t>::get().allocate();
         packet_buffer->offset = packet_buffer_constants::packet_buffer_initial_offset;
         packet_buffer->length = 0;
         packet_buffer->next = nullptr;
@@ -34,7 +38,7 @@ public:
     }
 
     static auto deallocate(packet_buffer_t *packet_buffer_address) -> void {
-        memory::buddy_allocator::get().deallocate(packet_buffer_address);
+        memory::slab_allocator<packet_buffer_t>::get().deallocate(packet_buffer_address);
     }
 
     auto get_packet() -> byte_t * {
@@ -0,0 +1,44 @@
+#ifndef PAGE_CACHE_HPP
+#define PAGE_CACHE_HPP
+
+#include "../lib/array.hpp"
+#include "../lib/span.hpp"
+#include "block_cache.hpp"
+#include "buddy_allocator.hpp"
+#include "file.hpp"
+#include "inode_cache.hpp"
+#include "sleep_lock.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace file {
+
+struct cached_page_t {
+    inode_index_t index_of_inode_on_disk = inode_index_t{0};
+    size_t page_index = 0;
+    memory::page_t *page = nullptr;
+    bool dirty = false;
+};
+
+class page_cache_t {
+public:
+    page_cache_t(block_cache_t *block_cache, inode_cache_t *inode_cache);
+    auto acquire(inode_index_t index_of_inode_on_disk, size_t page_index) -> memory::page_t *;
+    auto mark_dirty(inode_index_t index_of_inode_on_disk, size_t page_index) -> void;
+    auto synchronize(inode_index_t index_of_inode_on_disk, size_t first_page_index, size_t number_of_pages) -> void;
+    auto update(inode_index_t index_of_inode_on_disk, size_t offset, span_t<byte_t> buffer) -> void;
+    auto invalidate(inode_index_t index_of_inode_on_disk) -> void;
+
+private:
+    block_cache_t *block_cache = nullptr;
+    inode_cache_t *inode_cache = nullptr;
+    synchronization::sleep_lock lock;
+    array_t<cached_page_t, page_cache_constants::cache_size> pages;
+
+    auto write_back(cached_page_t &cached_page) -> void;
+};
+
+} // namespace file
+
+#endif
@@ -2,6 +2,8 @@
 #define PAGE_TABLE_HPP
 
 #include "../lib/array.hpp"
+#include "../lib/span.hpp"
+#include "integer.hpp"
 #include "memory.hpp"
 
 #include <cstddef>
@@ -9,6 +11,8 @@
 
 namespace memory {
 
+using page_t = array_t<byte_t, page_size>;
+
 class page_table_t;
 
 class page_table_descriptor_t {
@@ -17,14 +21,23 @@ public:
     page_table_descriptor_t(page_table_t *table_address);
     page_table_descriptor_t(uintptr_t table_address);
     page_table_descriptor_t(uintptr_t page_address, bool is_device_memory, bool is_read_only, bool is_privileged_only,
-                            bool is_privileged_executable, bool is_unprivileged_executable);
+                            bool is_privileged_executable, bool is_unprivileged_executable,
+                            bool is_copy_on_write = false);
     [[nodiscard]] auto is_valid() const -> bool;
+    [[nodiscard]] auto is_copy_on_write() const -> bool;
+    [[nodiscard]] auto is_user_writable() const -> bool;
+    [[nodiscard]] auto is_block() const -> bool;
+    [[nodiscard]] auto get_block_descriptor() const -> page_table_descriptor_t;
+    [[nodiscard]] auto get_page_descriptor(uintptr_t page_address) const -> page_table_descriptor_t;
+    [[nodiscard]] auto get_contiguous_descriptor() const -> page_table_descriptor_t;
     [[nodiscard]] auto get_next_level_table_address() const -> page_table_t *;
     [[nodiscard]] auto get_output_address_upper_bits() const -> uintptr_t;
 
 private:
     uint64_t value;
 
+    [[nodiscard]] auto get_table_bit() const -> bool;
+    auto set_table_bit(bool value) -> void;
     [[nodiscard]] auto get_next_level_table_address_bits() const -> uintptr_t;
     auto set_next_level_table_address_bits(uintptr_t value) -> void;
     [[nodiscard]] auto get_pxntable_bit() const -> bool;
@@ -57,30 +70,63 @@ private:
     auto set_pxn_bit(bool value) -> void;
     [[nodiscard]] auto get_uxn_bit() const -> bool;
     auto set_uxn_bit(bool value) -> void;
+    [[nodiscard]] auto get_copy_on_write_bit() const -> bool;
+    auto set_copy_on_write_bit(bool value) -> void;
 };
 static_assert(sizeof(page_table_descriptor_t) == sizeof(uint64_t));
 
+struct physical_range_t {
+    uintptr_t address;
+    size_t size;
+};
+
 class page_table_t {
 public:
-    enum class type_t { device, text, data, user };
+    enum class type_t { device, text, data, user, read_only, copy_on_write };
     enum class mode_t { create_el1_mapping, create_el0_mapping, do_not_create };
 
     auto get_descriptor_at_index(size_t index) -> page_table_descriptor_t &;
     void set_descriptor_at_index(size_t index, page_table_descriptor_t value);
     auto get_address_of_descriptor_at_index(size_t index) -> page_table_descriptor_t *;
     auto translate(uintptr_t virtual_address) -> uintptr_t;
+    auto translate_range(uintptr_t virtual_address, size_t size, span_t<physical_range_t> ranges,
+                         bool is_write = false) -> size_t;
     auto map(uintptr_t virtual_address, type_t type, uintptr_t physical_address, size_t size) -> void;
     auto map(uintptr_t virtual_address, type_t type, void *physical_address, size_t size) -> void;
     auto map(uintptr_t virtual_address, type_t type, void (*physical_address)(), size_t size) -> void;
+    auto map(uintptr_t virtual_address, type_t type, span_t<page_t *> pages) -> void;
     auto unmap(uintptr_t virtual_address, size_t size) -> void;
+    auto release(uintptr_t virtual_address, size_t size) -> void;
+    auto share(page_table_t *destination_page_table, uintptr_t virtual_address, size_t size, bool copy_on_write)
+        -> void;
+    auto resolve_copy_on_write(uintptr_t virtual_address) -> bool;
+    auto is_section_empty(uintptr_t virtual_address) -> bool;
+    auto is_user_writable(uintptr_t virtual_address) -> bool;
     auto clear() -> void;
 
 private:
+    friend class page_table_walker_t;
+
     auto walk(uintptr_t value, mode_t mode) -> page_table_descriptor_t *;
+    auto walk_to_level_2(uintptr_t value, mode_t mode) -> page_table_descriptor_t *;
+    auto split_block(page_table_descriptor_t *block_descriptor) -> void;
 
     array_t<page_table_descriptor_t, page_size / sizeof(page_table_descriptor_t)> data;
 };
 static_assert(sizeof(page_table_t) == page_size);
 
+class page_table_walker_t {
+public:
+    page_table_walker_t(page_table_t *level_0_page_table, page_table_t::mode_t mode);
+
+    auto walk(uintptr_t virtual_address) -> page_table_descriptor_t *;
+
+private:
+    page_table_t *level_0_page_table;
+    page_table_t::mode_t mode;
+    page_table_t *level_3_page_table = nullptr;
+    uintptr_t section_virtual_address = 0;
+};
+
 } // namespace memory
 #endif
@@ -2,10 +2,12 @@
 #define PIPE_INTERFACE_HPP
 
 #include "../lib/array.hpp"
+#include "../lib/span.hpp"
 #include "integer.hpp"
 #include "memory.hpp"
 #include "process.hpp"
 #include "spin_lock.hpp"
+#include "synchronization.hpp"
 
 #include <cstdint>
 
@@ -13,8 +15,12 @@ namespace process {
 
 class pipe_t {
 public:
-    auto read() -> byte_t;
-    auto write(byte_t value) -> void;
+    auto read(span_t<byte_t> data, bool blocking) -> size_t;
+    auto write(span_t<byte_t> data, bool blocking) -> size_t;
+    auto peek(span_t<byte_t> data, bool blocking) -> size_t;
+    auto get_free_space(bool blocking) -> size_t;
+    auto resize(size_t new_capacity) -> size_t;
+    auto poll() -> synchronization::readiness_t;
     auto open_reader() -> void;
     auto open_writer() -> void;
     auto close_reader() -> void;
@@ -23,18 +29,26 @@ public:
 
 private:
     synchronization::spin_lock lock;
-    array_t<byte_t, memory::page_size> *buffer = nullptr;
+    byte_t *buffer = nullptr;
+    size_t capacity = 0;
     size_t read_pointer = 0;
     size_t write_pointer = 0;
     int readers_count = 0;
     int writers_count = 0;
+
+    auto allocate_buffer() -> void;
+    auto deallocate_buffer() -> void;
 };
 
 class pipe_interface {
 public:
     auto get() -> int;
-    auto read(int pipe_index) -> byte_t;
-    auto write(int pipe_index, byte_t value) -> void;
+    auto read(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t;
+    auto write(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t;
+    auto peek(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t;
+    auto get_free_space(int pipe_index, bool blocking) -> size_t;
+    auto resize(int pipe_index, size_t new_capacity) -> size_t;
+    auto poll(int pipe_index) -> synchronization::readiness_t;
     auto open_reader(int pipe_index) -> void;
     auto open_writer(int pipe_index) -> void;
     auto close_reader(int pipe_index) -> void;
@@ -5,6 +5,7 @@
 #include "../lib/printf.hpp"
 #include "device.hpp"
 #include "spin_lock.hpp"
+#include "synchronization.hpp"
 
 namespace device {
 
@@ -69,6 +70,8 @@ public:
     auto flush_receiver_buffer() -> void;
     auto flush_transmitter_buffer() -> void;
 
+    auto poll() -> synchronization::readiness_t;
+
     [[nodiscard]] auto is_initialized() const -> bool;
 
     auto interrupt() -> void;
@@ -12,6 +12,12 @@ namespace thread_scheduler_constants {
     constexpr uint64_t time_slice_length_in_microseconds = 100000; // 100ms
     constexpr int maximum_number_of_processes = 32;
     constexpr int maximum_number_of_arguments = 64;
+    constexpr size_t maximum_size_of_arguments = memory::page_size * 4;
+    constexpr int maximum_number_of_wait_conditions = 64;
+    constexpr int maximum_number_of_regions = 16;
+    constexpr uint32_t map_anonymous = 0x1;
+    constexpr uint32_t map_shared = 0x2;
+    constexpr uint32_t map_writable = 0x4;
 } // namespace thread_scheduler_constants
 
 namespace exception_handler_constants::system_call_numbers {
@@ -33,11 +39,39 @@ namespace exception_handler_constants::system_call_numbers {
     constexpr int accept = 16;
     constexpr int receive = 17;
     constexpr int transmit = 18;
+    constexpr int read_at = 19;
+    constexpr int write_at = 20;
+    constexpr int read_vector = 21;
+    constexpr int write_vector = 22;
+    constexpr int send_file = 23;
+    constexpr int splice = 24;
+    constexpr int tee = 25;
+    constexpr int resize_pipe = 26;
+    constexpr int time = 27;
+    constexpr int poll = 28;
+    constexpr int create_event_set = 29;
+    constexpr int control_event_set = 30;
+    constexpr int wait_event_set = 31;
+    constexpr int set_non_blocking = 32;
+    constexpr int create_ring = 33;
+    constexpr int enter_ring = 34;
+    constexpr int free_memory = 35;
+    constexpr int brk = 36;
+    constexpr int sbrk = 37;
+    constexpr int mmap = 38;
+    constexpr int munmap = 39;
+    constexpr int msync = 40;
+    constexpr int create_shared_memory = 41;
+    constexpr int vfork = 42;
+    constexpr int spawn = 43;
+    constexpr int print_kernel_allocator_statistics = 44;
 } // namespace exception_handler_constants::system_call_numbers
 
 namespace pipe_interface_constants {
     constexpr int maximum_number_of_pipes = 64;
-}
+    constexpr int default_pipe_order = 0;
+    constexpr size_t maximum_pipe_order = 4;
+} // namespace pipe_interface_constants
 
 } // namespace process
 
@@ -7,7 +7,6 @@
 #include "gicv3_registers.hpp"
 #include "integer.hpp"
 #include "memory.hpp"
-#include "page_table.hpp"
 #include "pcie_configuration_space.hpp"
 #include "pl011_registers.hpp"
 #include "virtio_blk_registers.hpp"
@@ -83,23 +82,4 @@ private:
     span_t<byte_t> _value = {nullptr, 0};
 };
 
-template <> class reinterpretable_t<uintptr_t> {
-public:
-    reinterpretable_t(memory::page_table_t *page_table, uintptr_t value) : _page_table(page_table), _value(value) {}
-    template <typename T> auto to() const -> T * {
-        if (this->_page_table == nullptr) {
-            return nullptr;
-        }
-        auto physical_address = this->_page_table->translate(this->_value);
-        if (physical_address == 0) {
-            return nullptr;
-        }
-        return reinterpret_cast<T *>(memory::kernel_address_space_constants::virtual_address_begin + physical_address);
-    }
-
-private:
-    memory::page_table_t *_page_table = nullptr;
-    uintptr_t _value = 0;
-};
-
 #endif
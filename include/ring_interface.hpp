@@ -0,0 +1,60 @@
+#ifndef RING_INTERFACE_HPP
+#define RING_INTERFACE_HPP
+
+#include "../lib/array.hpp"
+#include "../lib/span.hpp"
+#include "external_types.hpp"
+#include "file.hpp"
+#include "memory.hpp"
+#include "page_table.hpp"
+#include "sleep_lock.hpp"
+#include "spin_lock.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace file {
+
+enum class ring_operation_t : uint8_t { none, read, write, send, receive, accept, synchronize };
+
+struct shared_ring_t {
+    ring_header_t header;
+    array_t<submission_entry_t, descriptor_interface_constants::number_of_ring_entries> submission_entries;
+    array_t<completion_entry_t, descriptor_interface_constants::number_of_ring_entries> completion_entries;
+};
+static_assert(sizeof(shared_ring_t) <= (memory::page_size << descriptor_interface_constants::ring_order));
+
+struct ring_t {
+    synchronization::sleep_lock lock;
+    int reference_count = 0;
+    uint64_t process_id = 0;
+    memory::page_table_t *level_0_page_table = nullptr;
+    shared_ring_t *shared_ring = nullptr;
+    uint32_t flags = 0;
+    array_t<submission_entry_t, descriptor_interface_constants::number_of_ring_entries> pending_entries{};
+    size_t number_of_pending_entries = 0;
+};
+
+class ring_interface {
+public:
+    auto create(uint64_t process_id, memory::page_table_t *level_0_page_table, uint32_t flags) -> int;
+    auto get_user_address(int ring_index) -> uintptr_t;
+    auto reference(int ring_index) -> void;
+    auto dereference(int ring_index) -> void;
+    auto enter(int ring_index, size_t minimum_number_of_completions) -> size_t;
+    auto handle_operations() -> void;
+
+private:
+    array_t<ring_t, descriptor_interface_constants::maximum_number_of_rings> rings;
+    synchronization::spin_lock lock;
+
+    auto process_rings(span_t<void *> conditions, size_t *number_of_conditions) -> bool;
+    auto process_ring(ring_t &ring, span_t<void *> conditions, size_t *number_of_conditions, bool *should_poll)
+        -> bool;
+    auto execute(ring_t &ring, submission_entry_t entry, void **condition_address) -> int64_t;
+    auto complete(ring_t &ring, uint64_t user_data, int64_t result) -> void;
+};
+
+} // namespace file
+
+#endif
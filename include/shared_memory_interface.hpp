@@ -0,0 +1,38 @@
+#ifndef SHARED_MEMORY_INTERFACE_HPP
+#define SHARED_MEMORY_INTERFACE_HPP
+
+#include "../lib/array.hpp"
+#include "buddy_allocator.hpp"
+#include "file.hpp"
+#include "page_table.hpp"
+#include "spin_lock.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace file {
+
+struct shared_memory_t {
+    int reference_count = 0;
+    size_t number_of_pages = 0;
+    array_t<memory::page_t *, descriptor_interface_constants::maximum_number_of_shared_memory_pages> pages{};
+};
+
+class shared_memory_interface {
+public:
+    auto create(size_t size) -> int;
+    auto reference(int shared_memory_index) -> void;
+    auto dereference(int shared_memory_index) -> void;
+    auto get_size(int shared_memory_index) -> size_t;
+    auto map(int shared_memory_index, memory::page_table_t *level_0_page_table, uintptr_t virtual_address,
+             memory::page_table_t::type_t type, size_t first_page_index, size_t number_of_pages) -> void;
+
+private:
+    array_t<shared_memory_t, descriptor_interface_constants::maximum_number_of_shared_memory_objects>
+        shared_memory_objects;
+    synchronization::spin_lock lock;
+};
+
+} // namespace file
+
+#endif
@@ -2,9 +2,11 @@
 #define SLAB_ALLOCATOR_HPP
 
 #include "../lib/array.hpp"
+#include "architecture.hpp"
 #include "buddy_allocator.hpp"
 #include "integer.hpp"
 #include "memory.hpp"
+#include "multiprocessing.hpp"
 #include "page_table.hpp"
 #include "panic.hpp"
 #include "pl011.hpp"
@@ -55,11 +57,25 @@ private:
     object_metadata_t<T> metadata;
 };
 
+template <typename T> constexpr auto get_number_of_objects_per_slab(int slab_order) -> int {
+    return static_cast<int>(((page_size << slab_order) - sizeof(slab_metadata_t<T>)) / sizeof(object_t<T>)) - 1;
+}
+
+template <typename T> constexpr auto get_slab_order() -> int {
+    auto slab_order = 0;
+    while (slab_order < slab_allocator_constants::maximum_slab_order &&
+           get_number_of_objects_per_slab<T>(slab_order) <
+               slab_allocator_constants::minimum_number_of_objects_per_slab) {
+        slab_order += 1;
+    }
+    return slab_order;
+}
+
 template <typename T> class slab_t {
 public:
     using object_data_t = typename object_t<T>::object_data_t;
-    static constexpr int maximum_number_of_objects_per_slab =
-        (page_size - sizeof(slab_metadata_t<T>)) / sizeof(object_t<T>) - 1;
+    static constexpr int slab_order = get_slab_order<T>();
+    static constexpr int maximum_number_of_objects_per_slab = get_number_of_objects_per_slab<T>(slab_order);
 
     auto initialize() -> void {
         for (auto index = 0; index < maximum_number_of_objects_per_slab; index += 1) {
@@ -84,6 +100,10 @@ public:
         this->metadata.number_of_allocated_objects = 0;
     }
 
+    auto get_object(int index) -> object_t<T> & {
+        return this->objects[index];
+    }
+
     auto get_address_of_previous_slab() -> slab_t<T> * {
         return this->metadata.pointer_to_previous_slab;
     }
@@ -146,13 +166,24 @@ public:
     }
 
 private:
-    array_t<object_t<T>, (page_size - sizeof(slab_metadata_t<T>)) / sizeof(object_t<T>) - 1> objects;
+    array_t<object_t<T>, maximum_number_of_objects_per_slab> objects;
     slab_metadata_t<T> metadata;
 };
 
+template <typename T> struct magazine_t {
+    array_t<T *, slab_allocator_constants::magazine_capacity> objects;
+    size_t number_of_objects = 0;
+};
+
+// Each core pops from and pushes to its loaded magazine and swaps with the other one before touching the slabs
+template <typename T> struct magazine_pair_t {
+    array_t<magazine_t<T>, 2> magazines;
+    size_t loaded_magazine_index = 0;
+};
+
 template <typename T> class slab_allocator {
-    static_assert(sizeof(slab_metadata_t<T>) < (page_size - sizeof(T)));
-    static_assert(sizeof(slab_t<T>) < page_size);
+    static_assert(get_number_of_objects_per_slab<T>(slab_t<T>::slab_order) > 0);
+    static_assert(sizeof(slab_t<T>) < (page_size << slab_t<T>::slab_order));
 
 public:
     static auto get() -> slab_allocator & {
@@ -161,7 +192,68 @@ public:
     }
 
     auto allocate() -> T * {
-        this->lock.acquire();
+        auto &magazine_pair = this->magazine_pairs[architecture::get_core_number()];
+        auto *loaded_magazine = &magazine_pair.magazines[magazine_pair.loaded_magazine_index];
+        if (loaded_magazine->number_of_objects == 0) {
+            magazine_pair.loaded_magazine_index ^= 1;
+            loaded_magazine = &magazine_pair.magazines[magazine_pair.loaded_magazine_index];
+            if (loaded_magazine->number_of_objects == 0) {
+                this->lock.acquire();
+                while (loaded_magazine->number_of_objects < slab_allocator_constants::magazine_capacity) {
+                    auto *value = this->allocate_from_slab();
+                    reinterpret_cast<object_t<T> *>(value)->set_allocation_state(false);
+                    loaded_magazine->objects[loaded_magazine->number_of_objects] = value;
+                    loaded_magazine->number_of_objects += 1;
+                }
+                this->lock.release();
+            }
+        }
+        loaded_magazine->number_of_objects -= 1;
+        auto *value = loaded_magazine->objects[loaded_magazine->number_of_objects];
+        reinterpret_cast<object_t<T> *>(value)->set_allocation_state(true);
+        return value;
+    }
+
+    auto deallocate(T *value) -> void {
+        auto object_address = reinterpret_cast<object_t<T> *>(value);
+        if (object_address->get_address_of_this_object() != object_address) {
+            panic("slab_allocator::deallocate");
+        }
+        if (!object_address->get_allocation_state()) {
+            panic("slab_allocator::deallocate");
+        }
+        object_address->set_allocation_state(false);
+        auto &magazine_pair = this->magazine_pairs[architecture::get_core_number()];
+        auto *loaded_magazine = &magazine_pair.magazines[magazine_pair.loaded_magazine_index];
+        if (loaded_magazine->number_of_objects == slab_allocator_constants::magazine_capacity) {
+            magazine_pair.loaded_magazine_index ^= 1;
+            loaded_magazine = &magazine_pair.magazines[magazine_pair.loaded_magazine_index];
+            if (loaded_magazine->number_of_objects == slab_allocator_constants::magazine_capacity) {
+                this->lock.acquire();
+                for (size_t i = 0; i < loaded_magazine->number_of_objects; i++) {
+                    this->deallocate_to_slab(loaded_magazine->objects[i]);
+                }
+                loaded_magazine->number_of_objects = 0;
+                this->lock.release();
+            }
+        }
+        loaded_magazine->objects[loaded_magazine->number_of_objects] = value;
+        loaded_magazine->number_of_objects += 1;
+    }
+
+    slab_allocator(const slab_allocator &) = delete;
+    auto operator=(const slab_allocator &) -> slab_allocator & = delete;
+    slab_allocator(slab_allocator &&) = delete;
+    auto operator=(slab_allocator &&) -> slab_allocator & = delete;
+
+private:
+    synchronization::spin_lock lock;
+    array_t<slab_t<T> *, slab_allocator_constants::number_of_partially_allocated_slab_lists>
+        partially_allocated_slabs{};
+    slab_t<T> *fully_allocated_slabs{};
+    array_t<magazine_pair_t<T>, architecture::number_of_cores> magazine_pairs{};
+
+    auto allocate_from_slab() -> T * {
         slab_t<T> *slab_address{};
         auto has_slab_with_unallocated_objects = false;
         for (auto &slab : this->partially_allocated_slabs) {
@@ -179,8 +271,14 @@ public:
                 }
             }
         } else {
-            slab_address = buddy_allocator::get().allocate<slab_t<T>>(0);
+            slab_address = buddy_allocator::get().allocate<slab_t<T>>(slab_t<T>::slab_order);
             slab_address->initialize();
+            // T::construct runs once per object here, and the object keeps its state across later reuse
+            if constexpr (requires(T *value) { T::construct(value); }) {
+                for (auto index = 0; index < slab_t<T>::maximum_number_of_objects_per_slab; index += 1) {
+                    T::construct(slab_address->get_object(index).get_address_of_data());
+                }
+            }
         }
         if (!slab_address) {
             panic("slab_allocator::allocate");
@@ -193,21 +291,12 @@ public:
             this->remove_slab_from_slab_list(slab_address);
         }
         this->insert_slab_into_slab_list(slab_address);
-        this->lock.release();
         return object_address->get_address_of_data();
     }
 
-    auto deallocate(T *value) -> void {
-        this->lock.acquire();
+    auto deallocate_to_slab(T *value) -> void {
         auto object_address = reinterpret_cast<object_t<T> *>(value);
-        if (object_address->get_address_of_this_object() != object_address) {
-            panic("slab_allocator::deallocate");
-        }
-        if (!object_address->get_allocation_state()) {
-            panic("slab_allocator::deallocate");
-        }
         auto slab_address = object_address->get_pointer_to_slab();
-        object_address->set_allocation_state(false);
         slab_address->insert_object_into_unallocated_list(object_address);
         slab_address->decrement_number_of_allocated_objects();
         this->remove_slab_from_slab_list(slab_address);
@@ -216,20 +305,8 @@ public:
         } else {
             this->insert_slab_into_slab_list(slab_address);
         }
-        this->lock.release();
     }
 
-    slab_allocator(const slab_allocator &) = delete;
-    auto operator=(const slab_allocator &) -> slab_allocator & = delete;
-    slab_allocator(slab_allocator &&) = delete;
-    auto operator=(slab_allocator &&) -> slab_allocator & = delete;
-
-private:
-    synchronization::spin_lock lock;
-    array_t<slab_t<T> *, slab_allocator_constants::number_of_partially_allocated_slab_lists>
-        partially_allocated_slabs{};
-    slab_t<T> *fully_allocated_slabs{};
-
     auto remove_slab_from_slab_list(slab_t<T> *slab_address) -> void {
         auto previous_slab_address = slab_address->get_address_of_previous_slab();
         auto next_slab_address = slab_address->get_address_of_next_slab();
@@ -4,6 +4,7 @@
 #include "../lib/span.hpp"
 #include "packet_buffer.hpp"
 #include "spin_lock.hpp"
+#include "synchronization.hpp"
 #include "thread_scheduler.hpp"
 
 #include <cstddef>
@@ -20,7 +21,8 @@ enum class request_status_t {
     already_exists_error,
     not_enough_resources_error,
     invalid_arguments_error,
-    unexpected_error
+    unexpected_error,
+    would_block
 };
 
 enum class request_type_t { open, close, receive, transmit };
@@ -30,6 +32,7 @@ struct request_t {
     request_status_t status = {};
     request_type_t type = {};
     bool active = true;
+    bool blocking = true;
     span_t<byte_t> buffer{nullptr, 0};
     size_t number_of_bytes_to_transfer = 0;
     size_t number_of_bytes_transferred = 0;
@@ -110,8 +113,10 @@ enum class socket_type_t { unused, tcp, udp };
 struct socket_t {
     synchronization::spin_lock lock = {};
     socket_type_t type = socket_type_t::unused;
+    int reference_count = 0;
     port_number_t source_port_number = {};
     size_t control_block_index = SIZE_MAX;
+    bool listening = false;
 };
 
 class socket_interface {
@@ -123,17 +128,19 @@ public:
 
     auto handle_open_call(socket_type_t socket_type) -> int;
     auto handle_close_call(int socket_index) -> bool;
+    auto handle_reference_call(int socket_index) -> void;
     auto handle_connect_call(int socket_index, internet_protocol_address_t destination_internet_protocol_address,
                              port_number_t destination_port_number) -> bool;
     auto handle_bind_call(int socket_index, port_number_t source_port_number) -> bool;
     auto handle_listen_call(int socket_index) -> bool;
-    auto handle_accept_call(int socket_index) -> int;
+    auto handle_accept_call(int socket_index, bool blocking) -> int;
     auto handle_receive_call(int socket_index, span_t<byte_t> buffer,
                              internet_protocol_address_t *internet_protocol_address_address,
-                             port_number_t *port_number_address) -> size_t;
+                             port_number_t *port_number_address, bool blocking) -> size_t;
     auto handle_transmit_call(int socket_index, span_t<byte_t> buffer,
-                              internet_protocol_address_t internet_protocol_address, port_number_t port_number)
-        -> size_t;
+                              internet_protocol_address_t internet_protocol_address, port_number_t port_number,
+                              bool blocking) -> size_t;
+    auto handle_poll_call(int socket_index) -> synchronization::readiness_t;
 
     auto handle_data_egress() -> void;
 
@@ -21,4 +21,7 @@ extern "C" const char _data_end_[];
 extern "C" const char _bss_begin_[];
 extern "C" const char _bss_end_[];
 
+// boot
+extern "C" uint64_t _device_tree_address_;
+
 #endif
@@ -1,10 +1,20 @@
 #ifndef SYNCHRONIZATION_HPP
 #define SYNCHRONIZATION_HPP
 
+#include <cstdint>
+
 namespace synchronization {
 
 constexpr int deadlock_threshold = 100000000;
+constexpr int64_t would_block = -2;
+
+struct readiness_t {
+    bool readable = false;
+    bool writable = false;
+    bool closed = false;
+    void *condition = nullptr;
+};
 
-}
+} // namespace synchronization
 
 #endif
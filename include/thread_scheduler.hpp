@@ -4,6 +4,7 @@
 #include "architecture.hpp"
 #include "exception_handler.hpp"
 #include "external_types.hpp"
+#include "file.hpp"
 #include "memory.hpp"
 #include "path_name.hpp"
 #include "process.hpp"
@@ -18,11 +19,22 @@ namespace process {
 
 enum class process_status { unused, reserved, runnable, running, sleeping, zombie, killed };
 
-struct section_detail_t {
+enum class region_type_t { unused, anonymous, file, mapped_file, shared_memory };
+
+struct region_t {
+    region_type_t type = region_type_t::unused;
     uintptr_t virtual_address = 0;
     size_t number_of_pages = 0;
+    bool writable = true;
+    file::inode_index_t index_of_inode_on_disk = file::inode_index_t{0};
+    uintptr_t file_virtual_address = 0;
+    size_t file_offset = 0;
+    size_t file_size = 0;
+    int shared_memory_index = -1;
 };
 
+using region_list_t = array_t<region_t, thread_scheduler_constants::maximum_number_of_regions>;
+
 struct kernel_stack_t {
     array_t<byte_t, memory::kernel_address_space_constants::stack_size - sizeof(exception_frame_t)> bytes{};
     exception_frame_t exception_frame;
@@ -31,17 +43,23 @@ static_assert(sizeof(kernel_stack_t) == memory::kernel_address_space_constants::
 
 struct process {
     synchronization::spin_lock lock;
+    synchronization::sleep_lock address_space_lock;
     process_status status = process_status::unused;
     int parent_id = 0;
     memory::page_table_t *level_0_page_table = nullptr;
-    array_t<section_detail_t, memory::page_size / sizeof(section_detail_t)> *section_details = nullptr;
+    region_list_t regions{};
     kernel_stack_t *kernel_stack_begin = nullptr;
     context kernel_mode_state;
     exception_frame_t *user_mode_state = nullptr;
     size_t text_size = 0;
+    uintptr_t heap_begin = 0;
     size_t heap_size = 0;
     size_t stack_size = 0;
+    bool borrows_address_space = false;
     void *condition = nullptr;
+    array_t<void *, thread_scheduler_constants::maximum_number_of_wait_conditions> wait_conditions{};
+    size_t number_of_wait_conditions = 0;
+    bool woken = false;
 };
 
 class thread_scheduler {
@@ -54,15 +72,28 @@ public:
     static auto initialize() -> void;
 
     auto fork() -> int;
+    auto vfork() -> int;
+    auto spawn(file::path_name_t executable_file_path, span_t<array_t<byte_t, memory::page_size> *> arguments,
+               span_t<int32_t> file_descriptor_map) -> int;
     auto wait() -> int;
     auto exit() -> void;
     auto exec(file::path_name_t executable_file_path, span_t<array_t<byte_t, memory::page_size> *> arguments) -> bool;
+    auto brk(uintptr_t new_break) -> uintptr_t;
+    auto sbrk(int64_t increment) -> uintptr_t;
+    auto mmap(uintptr_t address, size_t size, uint32_t flags, int file_descriptor_index, size_t offset) -> uintptr_t;
+    auto munmap(uintptr_t address, size_t size) -> bool;
+    auto msync(uintptr_t address, size_t size) -> bool;
 
     void schedule();
     void yield();
 
     void sleep(void *condition, synchronization::spin_lock &lock);
     void wake(void *condition);
+    void register_wait_conditions(span_t<void *> conditions);
+    void sleep_on_wait_conditions();
+
+    auto resolve_page_fault(memory::page_table_t *level_0_page_table, uintptr_t virtual_address) -> bool;
+    auto acquire_address_space(memory::page_table_t *level_0_page_table) -> process *;
 
     auto get_current_process() -> process &;
     auto get_current_process_id() -> int;
@@ -79,6 +110,14 @@ private:
 
     synchronization::spin_lock lock;
 
+    auto reserve_process() -> int;
+    auto find_address_space_owner(memory::page_table_t *level_0_page_table) -> process *;
+    auto resolve_page_fault(process &owner, memory::page_table_t *level_0_page_table, uintptr_t virtual_address)
+        -> bool;
+    auto load(int process_id, file::path_name_t executable_file_path,
+              span_t<array_t<byte_t, memory::page_size> *> arguments) -> bool;
+    auto return_address_space(process &borrowing_process) -> void;
+
     thread_scheduler() = default;
     ~thread_scheduler() = default;
 };
@@ -17,6 +17,7 @@ public:
     static auto initialize() -> void;
 
     [[nodiscard]] auto now() const -> uint64_t;
+    [[nodiscard]] static auto now_in_microseconds() -> uint64_t;
     auto interrupt() -> void;
 
     timer(const timer &) = delete;
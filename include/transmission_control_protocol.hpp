@@ -75,6 +75,8 @@ public:
     static auto handle_transmit_requests() -> void;
     static auto timeout() -> void;
     static auto sleep_until_established(size_t transmission_control_block_index) -> bool;
+    static auto is_pending(size_t transmission_control_block_index) -> bool;
+    static auto poll(size_t transmission_control_block_index, bool listening) -> synchronization::readiness_t;
 
     transmission_control_protocol_t(const transmission_control_protocol_t &) = delete;
     auto operator=(const transmission_control_protocol_t &) -> transmission_control_protocol_t & = delete;
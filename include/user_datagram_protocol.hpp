@@ -31,6 +31,7 @@ public:
                          user_datagram_protocol_packet_configuration_t packet_configuration) -> void;
     static auto request(request_t *request_address) -> void;
     static auto handle_transmit_requests() -> void;
+    static auto poll(size_t connection_index) -> synchronization::readiness_t;
 
     user_datagram_protocol_t(const user_datagram_protocol_t &) = delete;
     auto operator=(const user_datagram_protocol_t &) -> user_datagram_protocol_t & = delete;
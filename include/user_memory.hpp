@@ -0,0 +1,52 @@
+#ifndef USER_MEMORY_HPP
+#define USER_MEMORY_HPP
+
+#include "../lib/span.hpp"
+#include "integer.hpp"
+#include "memory.hpp"
+#include "page_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace memory {
+
+namespace user_memory_constants {
+    constexpr size_t maximum_number_of_ranges_per_walk = 16;
+    constexpr int maximum_copy_order = 4;
+} // namespace user_memory_constants
+
+struct user_buffer_t {
+    uintptr_t address = 0;
+    span_t<byte_t> kernel_span{};
+    bool is_copy = false;
+};
+
+auto copy_from_user(page_table_t *level_0_page_table, span_t<byte_t> destination, uintptr_t source_address) -> bool;
+auto copy_to_user(page_table_t *level_0_page_table, uintptr_t destination_address, span_t<byte_t> source) -> bool;
+auto copy_string_from_user(page_table_t *level_0_page_table, span_t<byte_t> destination, uintptr_t source_address)
+    -> bool;
+auto fault_in_user_range(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel)
+    -> bool;
+auto acquire_user_buffer(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel)
+    -> user_buffer_t;
+auto acquire_user_buffer(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel,
+                         bool may_resolve_page_faults) -> user_buffer_t;
+auto release_user_buffer(page_table_t *level_0_page_table, user_buffer_t buffer, size_t number_of_bytes_written)
+    -> bool;
+auto release_user_buffer(page_table_t *level_0_page_table, user_buffer_t buffer, size_t number_of_bytes_written,
+                         bool may_resolve_page_faults) -> bool;
+
+template <typename T>
+auto copy_from_user(page_table_t *level_0_page_table, span_t<T> destination, uintptr_t source_address) -> bool {
+    return copy_from_user(level_0_page_table, as_writable_bytes(destination), source_address);
+}
+
+template <typename T>
+auto copy_to_user(page_table_t *level_0_page_table, uintptr_t destination_address, span_t<T> source) -> bool {
+    return copy_to_user(level_0_page_table, destination_address, as_writable_bytes(source));
+}
+
+} // namespace memory
+
+#endif
@@ -2,9 +2,11 @@
 #define VIRTUAL_MEMORY_HPP
 
 #include "../lib/array.hpp"
+#include "architecture.hpp"
 #include "integer.hpp"
 #include "memory.hpp"
 #include "page_table.hpp"
+#include "spin_lock.hpp"
 #include "symbols.hpp"
 
 namespace memory {
@@ -21,9 +23,16 @@ public:
     auto get_address_of_kernel_page_table() -> page_table_t *;
     auto allocate_new_exception_level_1_page_table() -> page_table_t &;
 
-    static void set_translation_table_base_0_register(page_table_t *level_0_page_table_address);
+    auto switch_address_space(page_table_t *level_0_page_table_address) -> void;
+    auto release_address_space(page_table_t *level_0_page_table_address) -> void;
+
+    static void set_translation_table_base_0_register(page_table_t *level_0_page_table_address,
+                                                      uint64_t address_space_identifier);
     static void set_translation_table_base_1_register(page_table_t *level_0_page_table_address);
     static void flush_translation_lookaside_buffer();
+    static void flush_translation_lookaside_buffer(page_table_t *level_0_page_table_address);
+    static void flush_translation_lookaside_buffer(page_table_t *level_0_page_table_address,
+                                                   uintptr_t virtual_address);
 
     virtual_memory(const virtual_memory &) = delete;
     auto operator=(const virtual_memory &) -> virtual_memory & = delete;
@@ -33,9 +42,19 @@ public:
 private:
     __attribute__((aligned(page_size)))
     array_t<page_table_t, 2 * kernel_address_space_constants::address_space_size /
-                              (sizeof(page_table_t) / sizeof(page_table_descriptor_t) * page_size)>
+                                  (sizeof(page_table_t) / sizeof(page_table_descriptor_t) * page_size) +
+                              kernel_address_space_constants::maximum_physical_address_space_size /
+                                  (sizeof(page_table_t) / sizeof(page_table_descriptor_t) * section_size)>
         page_tables;
     int index = 1;
+    synchronization::spin_lock address_space_identifier_lock;
+    array_t<page_table_t *, virtual_memory_constants::number_of_address_space_identifiers>
+        address_space_identifier_owners{};
+    uint64_t next_address_space_identifier = 1;
+    array_t<bool, architecture::number_of_cores> is_local_flush_pending{};
+
+    auto find_address_space_identifier(page_table_t *level_0_page_table_address) -> uint64_t;
+    static void flush_local_translation_lookaside_buffer();
 
     virtual_memory() = default;
     ~virtual_memory() = default;
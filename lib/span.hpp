@@ -17,6 +17,8 @@ template <typename value_t> class span_t {
     friend auto as_writable_bytes<value_t>(span_t<value_t> span) -> span_t<byte_t>;
 
 public:
+    span_t() : _data(nullptr), _size(0) {}
+
     span_t(value_t *data, size_t size) : _data(data), _size(size) {}
 
     auto begin() -> iterator_t<span_t, value_t> {
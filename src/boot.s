@@ -8,6 +8,8 @@ _start:
         b secondary
 
 primary:
+        adrp x1, _device_tree_address_
+        str x0, [x1, :lo12:_device_tree_address_]
         adrp x1, _bss_begin_
         ldr w2, =_bss_size_
 
@@ -84,3 +86,9 @@ _setup:
         b main
         b .
 
+.section ".data"
+
+.global _device_tree_address_
+.balign 8
+_device_tree_address_:
+        .quad 0x0
@@ -1,4 +1,5 @@
 #include "../include/buddy_allocator.hpp"
+#include "../include/device_tree.hpp"
 #include "../include/multiprocessing.hpp"
 #include "../include/panic.hpp"
 #include "../include/reinterpretable.hpp"
@@ -9,147 +10,286 @@ namespace memory {
 
 auto buddy_allocator::initialize() -> void {
     if (architecture::get_core_number() == 0) {
+        auto memory_size = device::device_tree::get().get_memory_size();
         buddy_allocator::get().number_of_pages = (kernel_address_space_constants::physical_address_begin +
-                                                  kernel_address_space_constants::physical_address_space_size +
-                                                  kernel_address_space_constants::virtual_address_begin -
+                                                  memory_size + kernel_address_space_constants::virtual_address_begin -
                                                   reinterpretable_t<void *>(&_kernel_end_[0]).to_integer()) /
                                                  (page_size + sizeof(page_metadata_t));
         buddy_allocator::get().page_metadata_list =
             reinterpret_cast<array_t<page_metadata_t, hardware_maximum_number_of_pages> *>(
                 reinterpretable_t<void *>(&_kernel_end_[0]).to_integer());
+        auto pages_begin = ((reinterpretable_t<void *>(&_kernel_end_[0]).to_integer() +
+                             buddy_allocator::get().number_of_pages * sizeof(page_metadata_t)) |
+                            (section_size - 1)) +
+                           1;
         buddy_allocator::get().pages_base_address =
-            reinterpret_cast<array_t<page_t, hardware_maximum_number_of_pages> *>(
-                ((reinterpretable_t<void *>(&_kernel_end_[0]).to_integer() +
-                  buddy_allocator::get().number_of_pages * sizeof(page_metadata_t)) |
-                 (page_size - 1)) +
-                1);
+            reinterpret_cast<array_t<page_t, hardware_maximum_number_of_pages> *>(pages_begin);
+        buddy_allocator::get().number_of_pages =
+            (kernel_address_space_constants::physical_address_begin + memory_size +
+             kernel_address_space_constants::virtual_address_begin - pages_begin) /
+            page_size;
         for (auto &free_list : buddy_allocator::get().free_lists) {
             free_list = UINT64_MAX;
         }
-        int current_page_index = 0;
+        for (size_t i = 0; i < buddy_allocator::get().number_of_pages; i++) {
+            (*buddy_allocator::get().page_metadata_list)[i] = {};
+        }
+        uint64_t current_page_index = 0;
         while (buddy_allocator::get().number_of_pages - current_page_index > 0) {
             auto order =
                 uint64_width - 1 - __builtin_clzll(buddy_allocator::get().number_of_pages - current_page_index);
-            auto number_of_pages = 0x1ULL << order;
-            for (size_t i = 0; i < number_of_pages; i++) {
-                if (i == 0) {
-                    buddy_allocator::get().free_lists[order] = current_page_index;
-                    (*buddy_allocator::get().page_metadata_list)[current_page_index] = {page_state_t::unallocated,
-                                                                                        order, UINT64_MAX, UINT64_MAX};
-                } else {
-                    (*buddy_allocator::get().page_metadata_list)[current_page_index] = {page_state_t::subordinate, -1,
-                                                                                        UINT64_MAX, UINT64_MAX};
-                }
-                current_page_index += 1;
-            }
+            buddy_allocator::get().set_page_order(current_page_index, order);
+            buddy_allocator::get().set_page_state(current_page_index, page_state_t::unallocated);
+            buddy_allocator::get().insert_into_free_list(current_page_index, order);
+            current_page_index += 0x1ULL << order;
         }
+        buddy_allocator::get().number_of_free_pages = buddy_allocator::get().number_of_pages;
     }
 }
 
 void buddy_allocator::set_page_state(uint64_t index, page_state_t state) {
-    /*
-    auto page = page_metadata_list.offset_by_index(index).read();
-    page.state = state;
-    page_metadata_list.offset_by_index(index).write(page);
-    */
     (*page_metadata_list)[index].state = state;
 }
 
 void buddy_allocator::set_page_order(uint64_t index, int order) {
-    /*
-    auto page = page_metadata_list.offset_by_index(index).read();
-    page.order = order;
-    page_metadata_list.offset_by_index(index).write(page);
-    */
-    (*page_metadata_list)[index].order = order;
-}
-
-void buddy_allocator::set_page_previous(uint64_t index, uint64_t previous) {
-    /*
-    auto page = page_metadata_list.offset_by_index(index).read();
-    page.previous = previous;
-    page_metadata_list.offset_by_index(index).write(page);
-    */
-    (*page_metadata_list)[index].previous = previous;
+    (*page_metadata_list)[index].order = static_cast<int8_t>(order);
 }
 
-void buddy_allocator::set_page_next(uint64_t index, uint64_t next) {
-    /*
-    auto page = page_metadata_list.offset_by_index(index).read();
-    page.next = next;
-    page_metadata_list.offset_by_index(index).write(page);
-    */
-    (*page_metadata_list)[index].next = next;
+auto buddy_allocator::get_free_block(uint64_t index) -> free_block_t & {
+    return *reinterpretable_t<span_t<byte_t>>(span_t(&(*pages_base_address)[index][0], page_size)).to<free_block_t>();
 }
 
 void buddy_allocator::remove_from_free_list(uint64_t index, int order) {
-    if ((*page_metadata_list)[index].previous != UINT64_MAX) {
-        set_page_next((*page_metadata_list)[index].previous, (*page_metadata_list)[index].next);
+    auto &free_block = get_free_block(index);
+    if (free_block.previous != UINT64_MAX) {
+        get_free_block(free_block.previous).next = free_block.next;
     } else {
-        free_lists[order] = (*page_metadata_list)[index].next;
+        free_lists[order] = free_block.next;
+        if (free_lists[order] == UINT64_MAX) {
+            non_empty_orders &= ~(0x1ULL << order);
+        }
     }
-    if ((*page_metadata_list)[index].next != UINT64_MAX) {
-        set_page_previous((*page_metadata_list)[index].next, (*page_metadata_list)[index].previous);
+    if (free_block.next != UINT64_MAX) {
+        get_free_block(free_block.next).previous = free_block.previous;
     }
-    set_page_previous(index, UINT64_MAX);
-    set_page_next(index, UINT64_MAX);
 }
 
 void buddy_allocator::insert_into_free_list(uint64_t index, int order) {
+    auto &free_block = get_free_block(index);
     if (free_lists[order] != UINT64_MAX) {
-        set_page_previous(free_lists[order], index);
+        get_free_block(free_lists[order]).previous = index;
     }
-    set_page_previous(index, UINT64_MAX);
-    set_page_next(index, free_lists[order]);
+    free_block.previous = UINT64_MAX;
+    free_block.next = free_lists[order];
     free_lists[order] = index;
+    non_empty_orders |= 0x1ULL << order;
 }
 
 auto buddy_allocator::allocate(int order) -> span_t<byte_t> {
+    auto block = this->allocate_if_available(order);
+    if (block.size() == 0) {
+        panic("buddy_allocator::allocate");
+    }
+    return block;
+}
+
+auto buddy_allocator::allocate_if_available(int order) -> span_t<byte_t> {
+    auto block = this->allocate_from_free_lists(order);
+    if (block.size() != 0 || order != 0) {
+        return block;
+    }
+    auto index = this->take_zeroed_page();
+    if (index == UINT64_MAX) {
+        return {nullptr, 0};
+    }
+    __atomic_store_n(&(*page_metadata_list)[index].reference_count, 1, __ATOMIC_RELAXED);
+    return {&(*pages_base_address)[index][0], page_size};
+}
+
+// Never draws from the zeroed page pool, so refilling the pool cannot cycle its own pages
+auto buddy_allocator::allocate_from_free_lists(int order) -> span_t<byte_t> {
+    uint64_t index = UINT64_MAX;
+    if (order <= buddy_allocator_constants::maximum_cached_order) {
+        auto &page_cache = this->page_caches[architecture::get_core_number()][order];
+        if (page_cache.number_of_blocks == 0) {
+            this->refill_page_cache(page_cache, order);
+        }
+        if (page_cache.number_of_blocks != 0) {
+            index = page_cache.indices[page_cache.head];
+            page_cache.head = (page_cache.head + 1) % buddy_allocator_constants::page_cache_capacity;
+            page_cache.number_of_blocks -= 1;
+        }
+    } else {
+        this->lock.acquire();
+        index = this->allocate_block(order);
+        this->lock.release();
+    }
+    if (index == UINT64_MAX) {
+        return {nullptr, 0};
+    }
+    __atomic_store_n(&(*page_metadata_list)[index].reference_count, 1, __ATOMIC_RELAXED);
+    return {&(*pages_base_address)[index][0], page_size << order};
+}
+
+auto buddy_allocator::allocate_zeroed(int order) -> span_t<byte_t> {
+    if (order == 0) {
+        auto index = this->take_zeroed_page();
+        if (index != UINT64_MAX) {
+            __atomic_store_n(&(*page_metadata_list)[index].reference_count, 1, __ATOMIC_RELAXED);
+            return {&(*pages_base_address)[index][0], page_size};
+        }
+    }
+    auto block = this->allocate(order);
+    zero_pages(block);
+    return block;
+}
+
+auto buddy_allocator::take_zeroed_page() -> uint64_t {
+    auto index = UINT64_MAX;
+    this->zeroed_pages_lock.acquire();
+    if (this->number_of_zeroed_pages > 0) {
+        this->number_of_zeroed_pages -= 1;
+        index = this->zeroed_pages[this->number_of_zeroed_pages];
+    }
+    this->zeroed_pages_lock.release();
+    return index;
+}
+
+auto buddy_allocator::refill_zeroed_pages() -> void {
+    while (true) {
+        this->zeroed_pages_lock.acquire();
+        auto is_full = this->number_of_zeroed_pages == buddy_allocator_constants::zeroed_pool_capacity;
+        this->zeroed_pages_lock.release();
+        if (is_full) {
+            return;
+        }
+        auto page = this->allocate_from_free_lists(0);
+        if (page.size() == 0) {
+            return;
+        }
+        zero_pages(page);
+        this->zeroed_pages_lock.acquire();
+        if (this->number_of_zeroed_pages == buddy_allocator_constants::zeroed_pool_capacity) {
+            this->zeroed_pages_lock.release();
+            this->deallocate(page.data());
+            return;
+        }
+        this->zeroed_pages[this->number_of_zeroed_pages] = this->get_page_index(page.data());
+        this->number_of_zeroed_pages += 1;
+        this->zeroed_pages_lock.release();
+    }
+}
+
+auto buddy_allocator::handle_page_zeroing() -> void {
+    synchronization::spin_lock lock;
+    while (true) {
+        this->refill_zeroed_pages();
+        lock.acquire();
+        process::thread_scheduler::get().sleep(this, lock);
+        lock.release();
+    }
+}
+
+auto zero_pages(span_t<byte_t> pages) -> void {
+    uint64_t data_cache_zero_identifier = 0;
+    asm volatile("mrs %0, dczid_el0" : "=r"(data_cache_zero_identifier));
+    if ((data_cache_zero_identifier & buddy_allocator_constants::data_cache_zero_prohibited_bit) == 0) {
+        auto block_size_shift = data_cache_zero_identifier & buddy_allocator_constants::data_cache_zero_block_size_mask;
+        auto block_size = sizeof(uint32_t) << block_size_shift;
+        for (size_t offset = 0; offset < pages.size(); offset += block_size) {
+            asm volatile("dc zva, %0" : : "r"(&pages[offset]) : "memory");
+        }
+        return;
+    }
+    auto *words = reinterpretable_t<span_t<byte_t>>(pages).to<uint64_t>();
+    for (size_t i = 0; i < pages.size() / sizeof(uint64_t); i++) {
+        words[i] = 0;
+    }
+}
+
+auto buddy_allocator::allocate_block(int order) -> uint64_t {
+    auto candidate_orders = this->non_empty_orders & (UINT64_MAX << order);
+    if (candidate_orders == 0) {
+        return UINT64_MAX;
+    }
+    auto queried_order = __builtin_ctzll(candidate_orders);
+    auto index = this->free_lists[queried_order];
+    remove_from_free_list(index, queried_order);
+    while (queried_order > order) {
+        queried_order -= 1;
+        auto second_half_index = index + (0x1ULL << queried_order);
+        set_page_state(second_half_index, page_state_t::unallocated);
+        set_page_order(second_half_index, queried_order);
+        insert_into_free_list(second_half_index, queried_order);
+    }
+    set_page_state(index, page_state_t::allocated);
+    set_page_order(index, order);
+    this->number_of_free_pages -= 0x1ULL << order;
+    return index;
+}
+
+auto buddy_allocator::refill_page_cache(page_cache_t &page_cache, int order) -> void {
     this->lock.acquire();
-    auto requested_order = order;
-    auto queried_order = order;
-    while (queried_order < buddy_allocator_constants::maximum_order) {
-        if (requested_order == queried_order) {
-            if (this->free_lists[queried_order] != UINT64_MAX) {
-                auto index_of_pages_to_allocate = this->free_lists[queried_order];
-                remove_from_free_list(index_of_pages_to_allocate, queried_order);
-                set_page_state(index_of_pages_to_allocate, page_state_t::allocated);
-                this->lock.release();
-                return {&(*pages_base_address)[index_of_pages_to_allocate][0], page_size << order};
-            }
-            queried_order += 1;
-        }
-        if (requested_order < queried_order) {
-            if (this->free_lists[queried_order] != UINT64_MAX) {
-                auto number_of_pages_for_queried_order = 0x1 << queried_order;
-                auto index_of_pages_to_split = this->free_lists[queried_order];
-                auto first_half_index = this->free_lists[queried_order];
-                auto second_half_index = this->free_lists[queried_order] + number_of_pages_for_queried_order / 2;
-                remove_from_free_list(index_of_pages_to_split, queried_order);
-                insert_into_free_list(second_half_index, queried_order - 1);
-                insert_into_free_list(first_half_index, queried_order - 1);
-                set_page_state(first_half_index, page_state_t::unallocated);
-                set_page_order(first_half_index, queried_order - 1);
-                set_page_state(second_half_index, page_state_t::unallocated);
-                set_page_order(second_half_index, queried_order - 1);
-                queried_order -= 1;
-            } else {
-                queried_order += 1;
-            }
+    while (page_cache.number_of_blocks < buddy_allocator_constants::page_cache_batch_size) {
+        auto index = this->allocate_block(order);
+        if (index == UINT64_MAX) {
+            break;
         }
+        page_cache.indices[(page_cache.head + page_cache.number_of_blocks) %
+                           buddy_allocator_constants::page_cache_capacity] = index;
+        page_cache.number_of_blocks += 1;
     }
-    panic("buddy_allocator::allocate");
-    return {nullptr, 0};
+    this->lock.release();
 }
 
-auto buddy_allocator::deallocate(void *address) -> void {
+auto buddy_allocator::drain_page_cache(page_cache_t &page_cache) -> void {
     this->lock.acquire();
-    auto index = (reinterpretable_t<void *>(address).to_integer() -
-                  reinterpretable_t<void *>(this->pages_base_address).to_integer()) /
-                 page_size;
+    for (size_t i = 0; i < buddy_allocator_constants::page_cache_batch_size && page_cache.number_of_blocks > 0; i++) {
+        page_cache.number_of_blocks -= 1;
+        this->deallocate_block(page_cache.indices[(page_cache.head + page_cache.number_of_blocks) %
+                                                  buddy_allocator_constants::page_cache_capacity]);
+    }
+    this->lock.release();
+}
+
+auto buddy_allocator::get_page_index(const void *address) -> uint64_t {
+    return (reinterpretable_t<void *>(address).to_integer() -
+            reinterpretable_t<void *>(this->pages_base_address).to_integer()) /
+           page_size;
+}
+
+auto buddy_allocator::deallocate(void *address) -> void {
+    auto index = this->get_page_index(address);
     if ((*this->page_metadata_list)[index].state != page_state_t::allocated) {
         panic("buddy_allocator::deallocate");
     }
+    auto reference_count =
+        __atomic_sub_fetch(&(*this->page_metadata_list)[index].reference_count, 1, __ATOMIC_ACQ_REL);
+    if (reference_count > 0) {
+        return;
+    }
+    if (reference_count < 0) {
+        panic("buddy_allocator::deallocate, reference count");
+    }
+    auto order = (*this->page_metadata_list)[index].order;
+    if (order <= buddy_allocator_constants::maximum_cached_order) {
+        auto &page_cache = this->page_caches[architecture::get_core_number()][order];
+        if (page_cache.number_of_blocks == buddy_allocator_constants::page_cache_capacity) {
+            this->drain_page_cache(page_cache);
+        }
+        page_cache.head = (page_cache.head + buddy_allocator_constants::page_cache_capacity - 1) %
+                          buddy_allocator_constants::page_cache_capacity;
+        page_cache.indices[page_cache.head] = index;
+        page_cache.number_of_blocks += 1;
+        return;
+    }
+    this->lock.acquire();
+    this->deallocate_block(index);
+    this->lock.release();
+}
+
+auto buddy_allocator::deallocate_block(uint64_t index) -> void {
+    this->number_of_free_pages += 0x1ULL << (*this->page_metadata_list)[index].order;
     while (true) {
         auto order = (*this->page_metadata_list)[index].order;
         size_t buddy_index = 0;
@@ -178,10 +318,59 @@ auto buddy_allocator::deallocate(void *address) -> void {
         } else {
             set_page_state(index, page_state_t::unallocated);
             insert_into_free_list(index, order);
-            this->lock.release();
             return;
         }
     }
 }
 
+auto buddy_allocator::split(void *address) -> void {
+    this->lock.acquire();
+    auto index = this->get_page_index(address);
+    if ((*this->page_metadata_list)[index].state != page_state_t::allocated) {
+        panic("buddy_allocator::split");
+    }
+    auto number_of_pages = 0x1ULL << (*this->page_metadata_list)[index].order;
+    auto reference_count = (*this->page_metadata_list)[index].reference_count;
+    for (size_t i = 0; i < number_of_pages; i++) {
+        set_page_state(index + i, page_state_t::allocated);
+        set_page_order(index + i, 0);
+        (*this->page_metadata_list)[index + i].reference_count = reference_count;
+    }
+    this->lock.release();
+}
+
+auto buddy_allocator::reference(void *address) -> void {
+    auto index = this->get_page_index(address);
+    if ((*this->page_metadata_list)[index].state != page_state_t::allocated) {
+        panic("buddy_allocator::reference");
+    }
+    __atomic_add_fetch(&(*this->page_metadata_list)[index].reference_count, 1, __ATOMIC_RELAXED);
+}
+
+auto buddy_allocator::get_reference_count(void *address) -> int {
+    return __atomic_load_n(&(*this->page_metadata_list)[this->get_page_index(address)].reference_count,
+                           __ATOMIC_ACQUIRE);
+}
+
+auto buddy_allocator::contains(const void *address) -> bool {
+    auto address_value = reinterpretable_t<void *>(address).to_integer();
+    auto pages_begin = reinterpretable_t<void *>(this->pages_base_address).to_integer();
+    return address_value >= pages_begin && address_value < pages_begin + this->number_of_pages * page_size;
+}
+
+auto buddy_allocator::get_number_of_free_pages() -> size_t {
+    this->lock.acquire();
+    auto number_of_free_pages = this->number_of_free_pages;
+    this->lock.release();
+    this->zeroed_pages_lock.acquire();
+    number_of_free_pages += this->number_of_zeroed_pages;
+    this->zeroed_pages_lock.release();
+    for (auto &core_page_caches : this->page_caches) {
+        for (int order = 0; order <= buddy_allocator_constants::maximum_cached_order; order++) {
+            number_of_free_pages += core_page_caches[order].number_of_blocks << order;
+        }
+    }
+    return number_of_free_pages;
+}
+
 } // namespace memory
@@ -43,18 +43,11 @@ auto descriptor_interface::clone_file_descriptors(int from_process_id, int to_pr
     for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
         auto &original_file_descriptor = file_descriptors[from_process_id].data[i];
         auto &new_file_descriptor = file_descriptors[to_process_id].data[i];
+        if (original_file_descriptor.type == file_descriptor_type_t::ring) {
+            continue;
+        }
         if (original_file_descriptor.type != file_descriptor_type_t::unused) {
-            if (original_file_descriptor.type == file_descriptor_type_t::inode) {
-                inode_cache.reference(original_file_descriptor.index_of_inode_on_disk);
-            }
-            if (original_file_descriptor.type == file_descriptor_type_t::pipe) {
-                if (original_file_descriptor.readable) {
-                    pipes.open_reader(original_file_descriptor.pipe_index);
-                }
-                if (original_file_descriptor.writable) {
-                    pipes.open_writer(original_file_descriptor.pipe_index);
-                }
-            }
+            this->reference_file_descriptor(original_file_descriptor);
             new_file_descriptor = original_file_descriptor;
         }
     }
@@ -68,6 +61,72 @@ auto descriptor_interface::clone_file_descriptors(int from_process_id, int to_pr
     }
 }
 
+auto descriptor_interface::clone_file_descriptors(int from_process_id, int to_process_id,
+                                                  span_t<int32_t> file_descriptor_map) -> bool {
+    if (from_process_id == to_process_id ||
+        file_descriptor_map.size() > descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return false;
+    }
+    if (from_process_id > to_process_id) {
+        file_descriptors[to_process_id].lock.acquire();
+        file_descriptors[from_process_id].lock.acquire();
+    }
+    if (from_process_id < to_process_id) {
+        file_descriptors[from_process_id].lock.acquire();
+        file_descriptors[to_process_id].lock.acquire();
+    }
+    for (size_t i = 0; i < file_descriptor_map.size(); i++) {
+        auto original_file_descriptor_index = file_descriptor_map[i];
+        if (original_file_descriptor_index < 0 ||
+            original_file_descriptor_index >=
+                descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+            continue;
+        }
+        auto &original_file_descriptor = file_descriptors[from_process_id].data[original_file_descriptor_index];
+        if (original_file_descriptor.type == file_descriptor_type_t::unused ||
+            original_file_descriptor.type == file_descriptor_type_t::ring) {
+            continue;
+        }
+        this->reference_file_descriptor(original_file_descriptor);
+        file_descriptors[to_process_id].data[i] = original_file_descriptor;
+    }
+    if (from_process_id > to_process_id) {
+        file_descriptors[to_process_id].lock.release();
+        file_descriptors[from_process_id].lock.release();
+    }
+    if (from_process_id < to_process_id) {
+        file_descriptors[from_process_id].lock.release();
+        file_descriptors[to_process_id].lock.release();
+    }
+    return true;
+}
+
+auto descriptor_interface::reference_file_descriptor(file_descriptor_t &file_descriptor) -> void {
+    if (file_descriptor.type == file_descriptor_type_t::inode) {
+        inode_cache.reference(file_descriptor.index_of_inode_on_disk);
+    }
+    if (file_descriptor.type == file_descriptor_type_t::pipe) {
+        if (file_descriptor.readable) {
+            pipes.open_reader(file_descriptor.pipe_index);
+        }
+        if (file_descriptor.writable) {
+            pipes.open_writer(file_descriptor.pipe_index);
+        }
+    }
+    if (file_descriptor.type == file_descriptor_type_t::socket) {
+        networking::socket_interface::get().handle_reference_call(file_descriptor.socket_index);
+    }
+    if (file_descriptor.type == file_descriptor_type_t::event_set) {
+        reference_event_set(file_descriptor.event_set_index);
+    }
+    if (file_descriptor.type == file_descriptor_type_t::ring) {
+        rings.reference(file_descriptor.ring_index);
+    }
+    if (file_descriptor.type == file_descriptor_type_t::shared_memory) {
+        shared_memory_objects.reference(file_descriptor.shared_memory_index);
+    }
+}
+
 auto descriptor_interface::open(uint64_t process_id, path_name_t path, bool readable, bool writable, open_mode_t mode)
     -> int {
     block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
@@ -124,9 +183,13 @@ auto descriptor_interface::close(uint64_t process_id, uint64_t file_descriptor_i
 
     file_descriptors[process_id].lock.acquire();
     auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    auto index_of_deallocated_inode_on_disk = inode_index_t{0};
     if (file_descriptor.type == file_descriptor_type_t::inode) {
         inode_cache.dereference(file_descriptor.index_of_inode_on_disk);
         inode_cache.deallocate(file_descriptor.index_of_inode_on_disk);
+        if (inode_cache.status(file_descriptor.index_of_inode_on_disk).type == inode_type_t::unused) {
+            index_of_deallocated_inode_on_disk = file_descriptor.index_of_inode_on_disk;
+        }
     }
     if (file_descriptor.type == file_descriptor_type_t::pipe) {
         if (file_descriptor.readable) {
@@ -139,19 +202,93 @@ auto descriptor_interface::close(uint64_t process_id, uint64_t file_descriptor_i
     if (file_descriptor.type == file_descriptor_type_t::socket) {
         networking::socket_interface::get().handle_close_call(file_descriptor.socket_index);
     }
+    if (file_descriptor.type == file_descriptor_type_t::event_set) {
+        dereference_event_set(file_descriptor.event_set_index);
+    }
+    if (file_descriptor.type == file_descriptor_type_t::shared_memory) {
+        shared_memory_objects.dereference(file_descriptor.shared_memory_index);
+    }
+    auto ring_index = file_descriptor.type == file_descriptor_type_t::ring ? file_descriptor.ring_index : -1;
+    this->remove_from_event_sets(process_id, file_descriptor_index);
     file_descriptors[process_id].data[file_descriptor_index].type = file_descriptor_type_t::unused;
     file_descriptors[process_id].data[file_descriptor_index].readable = false;
     file_descriptors[process_id].data[file_descriptor_index].writable = false;
+    file_descriptors[process_id].data[file_descriptor_index].non_blocking = false;
     file_descriptors[process_id].data[file_descriptor_index].index_of_inode_on_disk = inode_index_t{0};
     file_descriptors[process_id].data[file_descriptor_index].read_offset = 0;
     file_descriptors[process_id].data[file_descriptor_index].write_offset = 0;
     file_descriptors[process_id].data[file_descriptor_index].pipe_index = -1;
     file_descriptors[process_id].data[file_descriptor_index].socket_index = -1;
+    file_descriptors[process_id].data[file_descriptor_index].event_set_index = -1;
+    file_descriptors[process_id].data[file_descriptor_index].ring_index = -1;
+    file_descriptors[process_id].data[file_descriptor_index].shared_memory_index = -1;
     file_descriptors[process_id].lock.release();
+    if (ring_index != -1) {
+        rings.dereference(ring_index);
+    }
     block_cache.close_transaction();
+    if (index_of_deallocated_inode_on_disk != 0) {
+        page_cache.invalidate(index_of_deallocated_inode_on_disk);
+    }
 }
 
 auto descriptor_interface::read(uint64_t process_id, uint64_t file_descriptor_index, span_t<byte_t> buffer) -> size_t {
+    return this->read_vector(process_id, file_descriptor_index, span_t(&buffer, 1));
+}
+
+auto descriptor_interface::write(uint64_t process_id, uint64_t file_descriptor_index, span_t<byte_t> buffer) -> size_t {
+    return this->write_vector(process_id, file_descriptor_index, span_t(&buffer, 1));
+}
+
+auto descriptor_interface::read_at(uint64_t process_id, uint64_t file_descriptor_index, size_t offset,
+                                   span_t<byte_t> buffer) -> size_t {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::inode || !file_descriptor.readable ||
+        file_descriptor.index_of_inode_on_disk == 0) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto result = this->read_inode(file_descriptor.index_of_inode_on_disk, offset, span_t(&buffer, 1));
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::write_at(uint64_t process_id, uint64_t file_descriptor_index, size_t offset,
+                                    span_t<byte_t> buffer) -> size_t {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::inode || !file_descriptor.writable ||
+        file_descriptor.index_of_inode_on_disk == 0) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto result = this->write_inode(file_descriptor.index_of_inode_on_disk, offset, span_t(&buffer, 1));
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::read_vector(uint64_t process_id, uint64_t file_descriptor_index,
+                                       span_t<span_t<byte_t>> buffers) -> size_t {
+    return this->read_vector(process_id, file_descriptor_index, buffers, true);
+}
+
+auto descriptor_interface::write_vector(uint64_t process_id, uint64_t file_descriptor_index,
+                                        span_t<span_t<byte_t>> buffers) -> size_t {
+    return this->write_vector(process_id, file_descriptor_index, buffers, true);
+}
+
+auto descriptor_interface::read_vector(uint64_t process_id, uint64_t file_descriptor_index,
+                                       span_t<span_t<byte_t>> buffers, bool may_block) -> size_t {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
     file_descriptors[process_id].lock.acquire();
     auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
     if (file_descriptor.type == file_descriptor_type_t::unused) {
@@ -167,32 +304,61 @@ auto descriptor_interface::read(uint64_t process_id, uint64_t file_descriptor_in
             file_descriptors[process_id].lock.release();
             return 0;
         }
-        block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
-        auto result = inode_cache.read(file_descriptor.index_of_inode_on_disk, file_descriptor.read_offset, buffer);
-        file_descriptor.read_offset += buffer.size();
-        block_cache.close_transaction();
+        auto result = this->read_inode(file_descriptor.index_of_inode_on_disk, file_descriptor.read_offset, buffers);
+        file_descriptor.read_offset += result;
         file_descriptors[process_id].lock.release();
         return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::pipe) {
         size_t result = 0;
-        for (auto &value : buffer) {
-            value = pipes.read(file_descriptor.pipe_index);
-            result += 1;
+        for (auto &buffer : buffers) {
+            auto number_of_bytes_read =
+                pipes.read(file_descriptor.pipe_index, buffer, may_block && !file_descriptor.non_blocking);
+            if (number_of_bytes_read == static_cast<size_t>(synchronization::would_block)) {
+                if (result == 0) {
+                    result = number_of_bytes_read;
+                }
+                break;
+            }
+            result += number_of_bytes_read;
+            if (number_of_bytes_read < buffer.size()) {
+                break;
+            }
         }
         file_descriptors[process_id].lock.release();
         return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::input) {
-        for (auto &value : buffer) {
-            value = device::pl011::get().read_receiver_buffer();
+        size_t result = 0;
+        for (auto &buffer : buffers) {
+            for (auto &value : buffer) {
+                if ((!may_block || file_descriptor.non_blocking) && !device::pl011::get().poll().readable) {
+                    file_descriptors[process_id].lock.release();
+                    return result == 0 ? static_cast<size_t>(synchronization::would_block) : result;
+                }
+                value = device::pl011::get().read_receiver_buffer();
+                result += 1;
+            }
         }
         file_descriptors[process_id].lock.release();
-        return buffer.size();
+        return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::socket) {
-        auto result =
-            networking::socket_interface::get().handle_receive_call(file_descriptor.socket_index, buffer, {}, {});
+        size_t result = 0;
+        for (auto &buffer : buffers) {
+            auto number_of_bytes_received = networking::socket_interface::get().handle_receive_call(
+                file_descriptor.socket_index, buffer, {}, {}, may_block && !file_descriptor.non_blocking);
+            if (number_of_bytes_received == static_cast<size_t>(synchronization::would_block)) {
+                if (result == 0) {
+                    result = number_of_bytes_received;
+                }
+                break;
+            }
+            result += number_of_bytes_received;
+            if (number_of_bytes_received < buffer.size()) {
+                break;
+            }
+        }
         file_descriptors[process_id].lock.release();
         return result;
     }
@@ -200,7 +366,11 @@ auto descriptor_interface::read(uint64_t process_id, uint64_t file_descriptor_in
     return 0;
 }
 
-auto descriptor_interface::write(uint64_t process_id, uint64_t file_descriptor_index, span_t<byte_t> buffer) -> size_t {
+auto descriptor_interface::write_vector(uint64_t process_id, uint64_t file_descriptor_index,
+                                        span_t<span_t<byte_t>> buffers, bool may_block) -> size_t {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
     file_descriptors[process_id].lock.acquire();
     auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
     if (file_descriptor.type == file_descriptor_type_t::unused) {
@@ -216,33 +386,63 @@ auto descriptor_interface::write(uint64_t process_id, uint64_t file_descriptor_i
             file_descriptors[process_id].lock.release();
             return 0;
         }
-        block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
-        auto result = inode_cache.write(file_descriptor.index_of_inode_on_disk, file_descriptor.write_offset, buffer);
-        block_cache.close_transaction();
-        file_descriptor.write_offset += buffer.size();
+        auto result =
+            this->write_inode(file_descriptor.index_of_inode_on_disk, file_descriptor.write_offset, buffers);
+        file_descriptor.write_offset += result;
         file_descriptors[process_id].lock.release();
         return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::pipe) {
         size_t result = 0;
-        for (auto &value : buffer) {
-            pipes.write(file_descriptor.pipe_index, value);
-            result += 1;
+        for (auto &buffer : buffers) {
+            auto number_of_bytes_written =
+                pipes.write(file_descriptor.pipe_index, buffer, may_block && !file_descriptor.non_blocking);
+            if (number_of_bytes_written == static_cast<size_t>(synchronization::would_block)) {
+                if (result == 0) {
+                    result = number_of_bytes_written;
+                }
+                break;
+            }
+            result += number_of_bytes_written;
+            if (number_of_bytes_written < buffer.size()) {
+                break;
+            }
         }
         file_descriptors[process_id].lock.release();
         return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::output) {
-        for (auto &value : buffer) {
-            device::pl011::get().write_transmitter_buffer(value);
+        size_t result = 0;
+        for (auto &buffer : buffers) {
+            for (auto &value : buffer) {
+                if ((!may_block || file_descriptor.non_blocking) && !device::pl011::get().poll().writable) {
+                    file_descriptors[process_id].lock.release();
+                    return result == 0 ? static_cast<size_t>(synchronization::would_block) : result;
+                }
+                device::pl011::get().write_transmitter_buffer(value);
+                result += 1;
+            }
         }
         file_descriptors[process_id].lock.release();
-        return buffer.size();
+        return result;
     }
     if (file_descriptor.type == file_descriptor_type_t::socket) {
-        auto result = networking::socket_interface::get().handle_transmit_call(
-            file_descriptor.socket_index, buffer, networking::internet_protocol_address_t{},
-            networking::port_number_t{});
+        size_t result = 0;
+        for (auto &buffer : buffers) {
+            auto number_of_bytes_transmitted = networking::socket_interface::get().handle_transmit_call(
+                file_descriptor.socket_index, buffer, networking::internet_protocol_address_t{},
+                networking::port_number_t{}, may_block && !file_descriptor.non_blocking);
+            if (number_of_bytes_transmitted == static_cast<size_t>(synchronization::would_block)) {
+                if (result == 0) {
+                    result = number_of_bytes_transmitted;
+                }
+                break;
+            }
+            result += number_of_bytes_transmitted;
+            if (number_of_bytes_transmitted < buffer.size()) {
+                break;
+            }
+        }
         file_descriptors[process_id].lock.release();
         return result;
     }
@@ -250,6 +450,184 @@ auto descriptor_interface::write(uint64_t process_id, uint64_t file_descriptor_i
     return 0;
 }
 
+auto descriptor_interface::read_inode(inode_index_t index_of_inode_on_disk, size_t offset,
+                                      span_t<span_t<byte_t>> buffers) -> size_t {
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    size_t result = 0;
+    for (auto &buffer : buffers) {
+        auto number_of_bytes_read = inode_cache.read(index_of_inode_on_disk, offset + result, buffer);
+        result += number_of_bytes_read;
+        if (number_of_bytes_read < buffer.size()) {
+            break;
+        }
+    }
+    block_cache.close_transaction();
+    return result;
+}
+
+auto descriptor_interface::read_inode(inode_index_t index_of_inode_on_disk, size_t offset, span_t<byte_t> buffer)
+    -> size_t {
+    return this->read_inode(index_of_inode_on_disk, offset, span_t(&buffer, 1));
+}
+
+auto descriptor_interface::acquire_mapped_page(inode_index_t index_of_inode_on_disk, size_t page_index)
+    -> memory::page_t * {
+    return page_cache.acquire(index_of_inode_on_disk, page_index);
+}
+
+auto descriptor_interface::mark_mapped_page_dirty(inode_index_t index_of_inode_on_disk, size_t page_index) -> void {
+    page_cache.mark_dirty(index_of_inode_on_disk, page_index);
+}
+
+auto descriptor_interface::synchronize_mapped_pages(inode_index_t index_of_inode_on_disk, size_t first_page_index,
+                                                    size_t number_of_pages) -> void {
+    page_cache.synchronize(index_of_inode_on_disk, first_page_index, number_of_pages);
+}
+
+auto descriptor_interface::create_shared_memory(uint64_t process_id, size_t size) -> int {
+    auto shared_memory_index = shared_memory_objects.create(size);
+    if (shared_memory_index == -1) {
+        return -1;
+    }
+    file_descriptors[process_id].lock.acquire();
+    int selected_file_descriptor_index = -1;
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
+        auto &file_descriptor = file_descriptors[process_id].data[i];
+        if (file_descriptor.type == file_descriptor_type_t::unused) {
+            file_descriptor.type = file_descriptor_type_t::shared_memory;
+            file_descriptor.readable = true;
+            file_descriptor.writable = true;
+            file_descriptor.shared_memory_index = shared_memory_index;
+            selected_file_descriptor_index = i;
+            break;
+        }
+    }
+    file_descriptors[process_id].lock.release();
+    if (selected_file_descriptor_index == -1) {
+        shared_memory_objects.dereference(shared_memory_index);
+    }
+    return selected_file_descriptor_index;
+}
+
+auto descriptor_interface::reference_shared_memory(uint64_t process_id, uint64_t file_descriptor_index) -> int {
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::shared_memory) {
+        file_descriptors[process_id].lock.release();
+        return -1;
+    }
+    auto shared_memory_index = file_descriptor.shared_memory_index;
+    shared_memory_objects.reference(shared_memory_index);
+    file_descriptors[process_id].lock.release();
+    return shared_memory_index;
+}
+
+auto descriptor_interface::reference_shared_memory(int shared_memory_index) -> void {
+    shared_memory_objects.reference(shared_memory_index);
+}
+
+auto descriptor_interface::release_shared_memory(int shared_memory_index) -> void {
+    shared_memory_objects.dereference(shared_memory_index);
+}
+
+auto descriptor_interface::map_shared_memory(int shared_memory_index, memory::page_table_t *level_0_page_table,
+                                             uintptr_t virtual_address, memory::page_table_t::type_t type,
+                                             size_t first_page_index, size_t number_of_pages) -> void {
+    shared_memory_objects.map(shared_memory_index, level_0_page_table, virtual_address, type, first_page_index,
+                              number_of_pages);
+}
+
+auto descriptor_interface::reference_inode(uint64_t process_id, uint64_t file_descriptor_index) -> inode_index_t {
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::inode || file_descriptor.index_of_inode_on_disk == 0) {
+        file_descriptors[process_id].lock.release();
+        block_cache.close_transaction();
+        return inode_index_t{0};
+    }
+    auto index_of_inode_on_disk = file_descriptor.index_of_inode_on_disk;
+    inode_cache.reference(index_of_inode_on_disk);
+    file_descriptors[process_id].lock.release();
+    block_cache.close_transaction();
+    return index_of_inode_on_disk;
+}
+
+auto descriptor_interface::reference_inode(inode_index_t index_of_inode_on_disk) -> void {
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    inode_cache.reference(index_of_inode_on_disk);
+    block_cache.close_transaction();
+}
+
+auto descriptor_interface::release_inode(inode_index_t index_of_inode_on_disk) -> void {
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    inode_cache.dereference(index_of_inode_on_disk);
+    inode_cache.deallocate(index_of_inode_on_disk);
+    auto is_deallocated = inode_cache.status(index_of_inode_on_disk).type == inode_type_t::unused;
+    block_cache.close_transaction();
+    if (is_deallocated) {
+        page_cache.invalidate(index_of_inode_on_disk);
+    }
+}
+
+// Each transaction covers a bounded number of data blocks plus the metadata they touch, so large writes and writes
+// past the end of the file are split instead of overflowing the journal reservation
+auto descriptor_interface::write_inode(inode_index_t index_of_inode_on_disk, size_t offset,
+                                       span_t<span_t<byte_t>> buffers) -> size_t {
+    constexpr int number_of_reserved_blocks =
+        descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction +
+        descriptor_interface_constants::maximum_number_of_data_blocks_per_write_transaction;
+    constexpr size_t maximum_chunk_size =
+        descriptor_interface_constants::maximum_number_of_data_blocks_per_write_transaction *
+        device::virtio_blk_block_size;
+    while (true) {
+        block_cache.open_transaction(number_of_reserved_blocks);
+        auto file_size = inode_cache.status(index_of_inode_on_disk).size;
+        if (file_size >= offset) {
+            block_cache.close_transaction();
+            break;
+        }
+        auto new_size = file_size - file_size % device::virtio_blk_block_size + maximum_chunk_size;
+        inode_cache.write(index_of_inode_on_disk, new_size < offset ? new_size : offset, span_t<byte_t>{});
+        block_cache.close_transaction();
+    }
+    size_t result = 0;
+    size_t buffer_index = 0;
+    size_t offset_in_buffer = 0;
+    auto is_short_write = false;
+    while (buffer_index < buffers.size() && !is_short_write) {
+        block_cache.open_transaction(number_of_reserved_blocks);
+        auto chunk_end = offset + result - (offset + result) % device::virtio_blk_block_size + maximum_chunk_size;
+        while (buffer_index < buffers.size() && offset + result < chunk_end) {
+            auto &buffer = buffers[buffer_index];
+            auto size = buffer.size() - offset_in_buffer;
+            if (size > chunk_end - (offset + result)) {
+                size = chunk_end - (offset + result);
+            }
+            auto number_of_bytes_written = inode_cache.write(index_of_inode_on_disk, offset + result,
+                                                             span_t(buffer.data() + offset_in_buffer, size));
+            result += number_of_bytes_written;
+            offset_in_buffer += number_of_bytes_written;
+            if (number_of_bytes_written < size) {
+                is_short_write = true;
+                break;
+            }
+            if (offset_in_buffer == buffer.size()) {
+                buffer_index += 1;
+                offset_in_buffer = 0;
+            }
+        }
+        block_cache.close_transaction();
+    }
+    size_t number_of_bytes_updated = 0;
+    for (auto &buffer : buffers) {
+        auto size = result - number_of_bytes_updated < buffer.size() ? result - number_of_bytes_updated : buffer.size();
+        page_cache.update(index_of_inode_on_disk, offset + number_of_bytes_updated, span_t(buffer.data(), size));
+        number_of_bytes_updated += size;
+    }
+    return result;
+}
+
 auto descriptor_interface::seek(uint64_t process_id, uint64_t file_descriptor_index, bool read, size_t new_read_offset,
                                 bool write, size_t new_write_offset) -> void {
     file_descriptors[process_id].lock.acquire();
@@ -312,6 +690,13 @@ auto descriptor_interface::status(uint64_t process_id, uint64_t file_descriptor_
         return {file_descriptor_type_t::inode, inode_status.type, inode_status.size, file_descriptor.readable,
                 file_descriptor.writable};
     }
+    if (file_descriptor.type == file_descriptor_type_t::shared_memory) {
+        auto size = shared_memory_objects.get_size(file_descriptor.shared_memory_index);
+        file_descriptors[process_id].lock.release();
+        block_cache.close_transaction();
+        return {file_descriptor_type_t::shared_memory, file::inode_type_t::unused, size, file_descriptor.readable,
+                file_descriptor.writable};
+    }
     file_descriptors[process_id].lock.release();
     block_cache.close_transaction();
     return {file_descriptor.type, file::inode_type_t::unused, 0, file_descriptor.readable, file_descriptor.writable};
@@ -396,17 +781,7 @@ auto descriptor_interface::copy(uint64_t file_descriptor_index) -> int {
             break;
         }
     }
-    if (from_file_descriptor.type == file_descriptor_type_t::inode) {
-        inode_cache.reference(from_file_descriptor.index_of_inode_on_disk);
-    }
-    if (from_file_descriptor.type == file_descriptor_type_t::pipe) {
-        if (from_file_descriptor.readable) {
-            pipes.open_reader(from_file_descriptor.pipe_index);
-        }
-        if (from_file_descriptor.writable) {
-            pipes.open_writer(from_file_descriptor.pipe_index);
-        }
-    }
+    this->reference_file_descriptor(from_file_descriptor);
     file_descriptors[process::thread_scheduler::get().get_current_process_id()].lock.release();
     return selected_file_descriptor_index;
 }
@@ -463,27 +838,34 @@ auto descriptor_interface::listen(uint64_t file_descriptor_index) -> bool {
 }
 
 auto descriptor_interface::accept(uint64_t file_descriptor_index) -> int {
-    auto socket_index = this->file_descriptors[process::thread_scheduler::get().get_current_process_id()]
-                            .data[file_descriptor_index]
-                            .socket_index;
-    auto new_socket_index = networking::socket_interface::get().handle_accept_call(socket_index);
-    if (new_socket_index == -1) {
+    return this->accept(process::thread_scheduler::get().get_current_process_id(), file_descriptor_index, true);
+}
+
+auto descriptor_interface::accept(uint64_t process_id, uint64_t file_descriptor_index, bool may_block) -> int {
+    auto &listening_file_descriptor = this->file_descriptors[process_id].data[file_descriptor_index];
+    if (listening_file_descriptor.type != file_descriptor_type_t::socket) {
         return -1;
     }
-    file_descriptors[process::thread_scheduler::get().get_current_process_id()].lock.acquire();
+    auto new_socket_index = networking::socket_interface::get().handle_accept_call(
+        listening_file_descriptor.socket_index, may_block && !listening_file_descriptor.non_blocking);
+    if (new_socket_index < 0) {
+        return new_socket_index;
+    }
+    file_descriptors[process_id].lock.acquire();
     int selected_file_descriptor_index = 0;
     for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
-        auto &file_descriptor = file_descriptors[process::thread_scheduler::get().get_current_process_id()].data[i];
+        auto &file_descriptor = file_descriptors[process_id].data[i];
         if (file_descriptor.type == file_descriptor_type_t::unused) {
             file_descriptor.type = file_descriptor_type_t::socket;
             file_descriptor.readable = true;
             file_descriptor.writable = true;
+            file_descriptor.non_blocking = listening_file_descriptor.non_blocking;
             file_descriptor.socket_index = new_socket_index;
             selected_file_descriptor_index = i;
             break;
         }
     }
-    file_descriptors[process::thread_scheduler::get().get_current_process_id()].lock.release();
+    file_descriptors[process_id].lock.release();
     if (selected_file_descriptor_index == 0) {
         networking::socket_interface::get().handle_close_call(new_socket_index);
         return -1;
@@ -494,21 +876,670 @@ auto descriptor_interface::accept(uint64_t file_descriptor_index) -> int {
 auto descriptor_interface::receive(uint64_t file_descriptor_index, span_t<byte_t> buffer,
                                    networking::internet_protocol_address_t *internet_protocol_address_address,
                                    networking::port_number_t *port_number_address) -> size_t {
-    auto socket_index = this->file_descriptors[process::thread_scheduler::get().get_current_process_id()]
-                            .data[file_descriptor_index]
-                            .socket_index;
-    return networking::socket_interface::get().handle_receive_call(
-        socket_index, buffer, internet_protocol_address_address, port_number_address);
+    auto &file_descriptor =
+        this->file_descriptors[process::thread_scheduler::get().get_current_process_id()].data[file_descriptor_index];
+    return networking::socket_interface::get().handle_receive_call(file_descriptor.socket_index, buffer,
+                                                                   internet_protocol_address_address,
+                                                                   port_number_address, !file_descriptor.non_blocking);
 }
 
 auto descriptor_interface::transmit(uint64_t file_descriptor_index, span_t<byte_t> buffer,
                                     networking::internet_protocol_address_t internet_protocol_address,
                                     networking::port_number_t port_number) -> size_t {
-    auto socket_index = this->file_descriptors[process::thread_scheduler::get().get_current_process_id()]
-                            .data[file_descriptor_index]
-                            .socket_index;
-    return networking::socket_interface::get().handle_transmit_call(socket_index, buffer, internet_protocol_address,
-                                                                    port_number);
+    auto &file_descriptor =
+        this->file_descriptors[process::thread_scheduler::get().get_current_process_id()].data[file_descriptor_index];
+    return networking::socket_interface::get().handle_transmit_call(
+        file_descriptor.socket_index, buffer, internet_protocol_address, port_number, !file_descriptor.non_blocking);
+}
+
+auto descriptor_interface::send_file(uint64_t process_id, uint64_t output_file_descriptor_index,
+                                     uint64_t input_file_descriptor_index, size_t offset, size_t size) -> size_t {
+    if (output_file_descriptor_index >=
+            descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        input_file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    file_descriptors[process_id].lock.acquire();
+    auto &output_file_descriptor = file_descriptors[process_id].data[output_file_descriptor_index];
+    auto &input_file_descriptor = file_descriptors[process_id].data[input_file_descriptor_index];
+    if (output_file_descriptor.type != file_descriptor_type_t::socket || !output_file_descriptor.writable) {
+        file_descriptors[process_id].lock.release();
+        block_cache.close_transaction();
+        return 0;
+    }
+    if (input_file_descriptor.type != file_descriptor_type_t::inode || !input_file_descriptor.readable ||
+        input_file_descriptor.index_of_inode_on_disk == 0) {
+        file_descriptors[process_id].lock.release();
+        block_cache.close_transaction();
+        return 0;
+    }
+    auto index_of_inode_on_disk = input_file_descriptor.index_of_inode_on_disk;
+    auto socket_index = output_file_descriptor.socket_index;
+    auto blocking = !output_file_descriptor.non_blocking;
+    inode_cache.reference(index_of_inode_on_disk);
+    networking::socket_interface::get().handle_reference_call(socket_index);
+    file_descriptors[process_id].lock.release();
+    block_cache.close_transaction();
+
+    auto buffer_span = memory::buddy_allocator::get().allocate(descriptor_interface_constants::send_file_buffer_order);
+    size_t result = 0;
+    while (result < size) {
+        auto number_of_bytes_to_transfer = size - result;
+        if (number_of_bytes_to_transfer > buffer_span.size()) {
+            number_of_bytes_to_transfer = buffer_span.size();
+        }
+        auto chunk_span = span_t(buffer_span.data(), number_of_bytes_to_transfer);
+        auto number_of_bytes_read = this->read_inode(index_of_inode_on_disk, offset + result, span_t(&chunk_span, 1));
+        if (number_of_bytes_read == 0) {
+            break;
+        }
+        auto number_of_bytes_transmitted = networking::socket_interface::get().handle_transmit_call(
+            socket_index, span_t(buffer_span.data(), number_of_bytes_read), networking::internet_protocol_address_t{},
+            networking::port_number_t{}, blocking);
+        if (number_of_bytes_transmitted == static_cast<size_t>(synchronization::would_block)) {
+            if (result == 0) {
+                result = number_of_bytes_transmitted;
+            }
+            break;
+        }
+        result += number_of_bytes_transmitted;
+        if (number_of_bytes_transmitted < number_of_bytes_read) {
+            break;
+        }
+    }
+    memory::buddy_allocator::get().deallocate(buffer_span.data());
+    networking::socket_interface::get().handle_close_call(socket_index);
+    this->release_inode(index_of_inode_on_disk);
+    return result;
+}
+
+auto descriptor_interface::splice(uint64_t process_id, uint64_t input_file_descriptor_index,
+                                  uint64_t output_file_descriptor_index, size_t size) -> size_t {
+    if (input_file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        output_file_descriptor_index >=
+            descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &input_file_descriptor = file_descriptors[process_id].data[input_file_descriptor_index];
+    auto &output_file_descriptor = file_descriptors[process_id].data[output_file_descriptor_index];
+    if (input_file_descriptor.type == file_descriptor_type_t::unused || !input_file_descriptor.readable ||
+        output_file_descriptor.type == file_descriptor_type_t::unused || !output_file_descriptor.writable) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto input_type = input_file_descriptor.type;
+    auto input_pipe_index = input_file_descriptor.pipe_index;
+    auto input_blocking = !input_file_descriptor.non_blocking;
+    auto index_of_inode_on_disk = input_file_descriptor.index_of_inode_on_disk;
+    auto input_offset = input_file_descriptor.read_offset;
+    auto output_type = output_file_descriptor.type;
+    auto output_pipe_index = output_file_descriptor.pipe_index;
+    auto output_blocking = !output_file_descriptor.non_blocking;
+    file_descriptors[process_id].lock.release();
+    if (input_type == file_descriptor_type_t::inode && index_of_inode_on_disk == 0) {
+        return 0;
+    }
+    if (input_type == file_descriptor_type_t::pipe && output_type == file_descriptor_type_t::pipe &&
+        input_pipe_index == output_pipe_index) {
+        return 0;
+    }
+    // Sockets and the console consume what they return, so their data is only moved into outputs that cannot
+    // accept less than what was read
+    auto is_input_consumed_by_reading =
+        input_type != file_descriptor_type_t::pipe && input_type != file_descriptor_type_t::inode;
+    if (is_input_consumed_by_reading && output_type != file_descriptor_type_t::pipe &&
+        output_type != file_descriptor_type_t::inode) {
+        return 0;
+    }
+
+    auto buffer_span = memory::buddy_allocator::get().allocate(descriptor_interface_constants::splice_buffer_order);
+    size_t result = 0;
+    while (result < size) {
+        auto number_of_bytes_to_transfer = size - result;
+        if (number_of_bytes_to_transfer > buffer_span.size()) {
+            number_of_bytes_to_transfer = buffer_span.size();
+        }
+        size_t number_of_bytes_read = 0;
+        if (input_type == file_descriptor_type_t::pipe) {
+            number_of_bytes_read = pipes.peek(input_pipe_index, span_t(buffer_span.data(), number_of_bytes_to_transfer),
+                                              input_blocking && result == 0);
+        } else if (input_type == file_descriptor_type_t::inode) {
+            auto chunk_span = span_t(buffer_span.data(), number_of_bytes_to_transfer);
+            number_of_bytes_read =
+                this->read_inode(index_of_inode_on_disk, input_offset + result, span_t(&chunk_span, 1));
+        } else {
+            if (result > 0) {
+                break;
+            }
+            if (output_type == file_descriptor_type_t::pipe) {
+                auto free_space = pipes.get_free_space(output_pipe_index, output_blocking);
+                if (free_space == static_cast<size_t>(synchronization::would_block)) {
+                    result = free_space;
+                    break;
+                }
+                if (free_space == 0) {
+                    break;
+                }
+                if (number_of_bytes_to_transfer > free_space) {
+                    number_of_bytes_to_transfer = free_space;
+                }
+            }
+            number_of_bytes_read = this->read(process_id, input_file_descriptor_index,
+                                              span_t(buffer_span.data(), number_of_bytes_to_transfer));
+        }
+        if (number_of_bytes_read == static_cast<size_t>(synchronization::would_block)) {
+            if (result == 0) {
+                result = number_of_bytes_read;
+            }
+            break;
+        }
+        if (number_of_bytes_read == 0) {
+            break;
+        }
+        size_t number_of_bytes_written = 0;
+        if (is_input_consumed_by_reading && output_type == file_descriptor_type_t::pipe) {
+            number_of_bytes_written =
+                pipes.write(output_pipe_index, span_t(buffer_span.data(), number_of_bytes_read), true);
+        } else {
+            number_of_bytes_written = this->write(process_id, output_file_descriptor_index,
+                                                  span_t(buffer_span.data(), number_of_bytes_read));
+        }
+        if (number_of_bytes_written == static_cast<size_t>(synchronization::would_block)) {
+            if (result == 0) {
+                result = number_of_bytes_written;
+            }
+            break;
+        }
+        if (input_type == file_descriptor_type_t::pipe) {
+            pipes.read(input_pipe_index, span_t(buffer_span.data(), number_of_bytes_written), false);
+        }
+        result += number_of_bytes_written;
+        if (number_of_bytes_written < number_of_bytes_read) {
+            break;
+        }
+    }
+    memory::buddy_allocator::get().deallocate(buffer_span.data());
+
+    if (input_type == file_descriptor_type_t::inode && result != static_cast<size_t>(synchronization::would_block)) {
+        file_descriptors[process_id].lock.acquire();
+        if (input_file_descriptor.type == file_descriptor_type_t::inode &&
+            input_file_descriptor.index_of_inode_on_disk == index_of_inode_on_disk) {
+            input_file_descriptor.read_offset += result;
+        }
+        file_descriptors[process_id].lock.release();
+    }
+    return result;
+}
+
+auto descriptor_interface::tee(uint64_t process_id, uint64_t input_file_descriptor_index,
+                               uint64_t output_file_descriptor_index, size_t size) -> size_t {
+    if (input_file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        output_file_descriptor_index >=
+            descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &input_file_descriptor = file_descriptors[process_id].data[input_file_descriptor_index];
+    auto &output_file_descriptor = file_descriptors[process_id].data[output_file_descriptor_index];
+    if (input_file_descriptor.type != file_descriptor_type_t::pipe || !input_file_descriptor.readable) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    if (output_file_descriptor.type != file_descriptor_type_t::pipe || !output_file_descriptor.writable) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    if (input_file_descriptor.pipe_index == output_file_descriptor.pipe_index) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto input_pipe_index = input_file_descriptor.pipe_index;
+    auto blocking = !input_file_descriptor.non_blocking;
+    file_descriptors[process_id].lock.release();
+
+    auto buffer_span = memory::buddy_allocator::get().allocate(descriptor_interface_constants::splice_buffer_order);
+    auto number_of_bytes_to_transfer = size > buffer_span.size() ? buffer_span.size() : size;
+    auto number_of_bytes_peeked =
+        pipes.peek(input_pipe_index, span_t(buffer_span.data(), number_of_bytes_to_transfer), blocking);
+    if (number_of_bytes_peeked == static_cast<size_t>(synchronization::would_block)) {
+        memory::buddy_allocator::get().deallocate(buffer_span.data());
+        return number_of_bytes_peeked;
+    }
+    auto result =
+        this->write(process_id, output_file_descriptor_index, span_t(buffer_span.data(), number_of_bytes_peeked));
+    memory::buddy_allocator::get().deallocate(buffer_span.data());
+    return result;
+}
+
+auto descriptor_interface::resize_pipe(uint64_t process_id, uint64_t file_descriptor_index, size_t new_capacity)
+    -> size_t {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::pipe) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto result = pipes.resize(file_descriptor.pipe_index, new_capacity);
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::set_non_blocking(uint64_t process_id, uint64_t file_descriptor_index, bool non_blocking)
+    -> bool {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return false;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    if (file_descriptor.type == file_descriptor_type_t::unused) {
+        file_descriptors[process_id].lock.release();
+        return false;
+    }
+    file_descriptor.non_blocking = non_blocking;
+    file_descriptors[process_id].lock.release();
+    return true;
+}
+
+auto descriptor_interface::poll(uint64_t process_id, span_t<poll_descriptor_t> poll_descriptors, bool blocking)
+    -> size_t {
+    array_t<void *, descriptor_interface_constants::maximum_number_of_file_descriptors_per_process> conditions{};
+    auto conditions_span = span_t(&conditions[0], poll_descriptors.size());
+    auto result = this->poll_file_descriptors(process_id, poll_descriptors, conditions_span);
+    while (result == 0 && blocking) {
+        process::thread_scheduler::get().register_wait_conditions(conditions_span);
+        result = this->poll_file_descriptors(process_id, poll_descriptors, conditions_span);
+        if (result != 0) {
+            process::thread_scheduler::get().register_wait_conditions(span_t<void *>{});
+            break;
+        }
+        process::thread_scheduler::get().sleep_on_wait_conditions();
+        result = this->poll_file_descriptors(process_id, poll_descriptors, conditions_span);
+    }
+    return result;
+}
+
+auto descriptor_interface::create_event_set(uint64_t process_id) -> int {
+    event_set_lock.acquire();
+    int event_set_index = -1;
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_event_sets; i++) {
+        if (event_sets[i].reference_count == 0) {
+            event_sets[i].reference_count = 1;
+            for (auto &entry : event_sets[i].entries) {
+                entry = event_set_entry_t{};
+            }
+            event_set_index = i;
+            break;
+        }
+    }
+    event_set_lock.release();
+    if (event_set_index == -1) {
+        return -1;
+    }
+    file_descriptors[process_id].lock.acquire();
+    int selected_file_descriptor_index = -1;
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
+        auto &file_descriptor = file_descriptors[process_id].data[i];
+        if (file_descriptor.type == file_descriptor_type_t::unused) {
+            file_descriptor.type = file_descriptor_type_t::event_set;
+            file_descriptor.readable = true;
+            file_descriptor.writable = false;
+            file_descriptor.event_set_index = event_set_index;
+            selected_file_descriptor_index = i;
+            break;
+        }
+    }
+    file_descriptors[process_id].lock.release();
+    if (selected_file_descriptor_index == -1) {
+        dereference_event_set(event_set_index);
+    }
+    return selected_file_descriptor_index;
+}
+
+auto descriptor_interface::control_event_set(uint64_t process_id, uint64_t event_set_file_descriptor_index,
+                                             uint64_t file_descriptor_index, event_set_operation_t operation,
+                                             uint16_t events) -> bool {
+    if (event_set_file_descriptor_index >=
+            descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return false;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &event_set_file_descriptor = file_descriptors[process_id].data[event_set_file_descriptor_index];
+    if (event_set_file_descriptor.type != file_descriptor_type_t::event_set) {
+        file_descriptors[process_id].lock.release();
+        return false;
+    }
+    auto &event_set = event_sets[event_set_file_descriptor.event_set_index];
+    event_set_lock.acquire();
+    event_set_entry_t *selected_entry = nullptr;
+    event_set_entry_t *empty_entry = nullptr;
+    for (auto &entry : event_set.entries) {
+        if (entry.file_descriptor_index == static_cast<int>(file_descriptor_index)) {
+            selected_entry = &entry;
+        }
+        if (entry.file_descriptor_index == -1 && empty_entry == nullptr) {
+            empty_entry = &entry;
+        }
+    }
+    auto result = false;
+    switch (operation) {
+    case event_set_operation_t::add:
+        if (selected_entry == nullptr && empty_entry != nullptr &&
+            file_descriptors[process_id].data[file_descriptor_index].type != file_descriptor_type_t::unused) {
+            *empty_entry = event_set_entry_t{static_cast<int>(file_descriptor_index), events, 0};
+            result = true;
+        }
+        break;
+    case event_set_operation_t::modify:
+        if (selected_entry != nullptr) {
+            *selected_entry = event_set_entry_t{static_cast<int>(file_descriptor_index), events, 0};
+            result = true;
+        }
+        break;
+    case event_set_operation_t::remove:
+        if (selected_entry != nullptr) {
+            *selected_entry = event_set_entry_t{};
+            result = true;
+        }
+        break;
+    }
+    event_set_lock.release();
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::wait_event_set(uint64_t process_id, uint64_t event_set_file_descriptor_index,
+                                          span_t<poll_descriptor_t> poll_descriptors, bool blocking) -> size_t {
+    if (event_set_file_descriptor_index >=
+        descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &event_set_file_descriptor = file_descriptors[process_id].data[event_set_file_descriptor_index];
+    if (event_set_file_descriptor.type != file_descriptor_type_t::event_set) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto event_set_index = event_set_file_descriptor.event_set_index;
+    file_descriptors[process_id].lock.release();
+
+    array_t<void *, descriptor_interface_constants::maximum_number_of_file_descriptors_per_process> conditions{};
+    auto conditions_span =
+        span_t(&conditions[0], descriptor_interface_constants::maximum_number_of_file_descriptors_per_process);
+    auto result = this->poll_event_set(process_id, event_set_index, poll_descriptors, conditions_span);
+    while (result == 0 && blocking) {
+        process::thread_scheduler::get().register_wait_conditions(conditions_span);
+        result = this->poll_event_set(process_id, event_set_index, poll_descriptors, conditions_span);
+        if (result != 0) {
+            process::thread_scheduler::get().register_wait_conditions(span_t<void *>{});
+            break;
+        }
+        process::thread_scheduler::get().sleep_on_wait_conditions();
+        result = this->poll_event_set(process_id, event_set_index, poll_descriptors, conditions_span);
+    }
+    return result;
+}
+
+auto descriptor_interface::create_ring(uint64_t process_id, memory::page_table_t *level_0_page_table, uint32_t flags,
+                                       uintptr_t *user_address_address) -> int {
+    auto ring_index = rings.create(process_id, level_0_page_table, flags);
+    if (ring_index == -1) {
+        return -1;
+    }
+    file_descriptors[process_id].lock.acquire();
+    int selected_file_descriptor_index = -1;
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
+        auto &file_descriptor = file_descriptors[process_id].data[i];
+        if (file_descriptor.type == file_descriptor_type_t::unused) {
+            file_descriptor.type = file_descriptor_type_t::ring;
+            file_descriptor.readable = false;
+            file_descriptor.writable = false;
+            file_descriptor.ring_index = ring_index;
+            selected_file_descriptor_index = i;
+            break;
+        }
+    }
+    file_descriptors[process_id].lock.release();
+    if (selected_file_descriptor_index == -1) {
+        rings.dereference(ring_index);
+        return -1;
+    }
+    *user_address_address = rings.get_user_address(ring_index);
+    return selected_file_descriptor_index;
+}
+
+auto descriptor_interface::enter_ring(uint64_t process_id, uint64_t ring_file_descriptor_index,
+                                      size_t minimum_number_of_completions) -> size_t {
+    if (ring_file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return 0;
+    }
+    file_descriptors[process_id].lock.acquire();
+    auto &file_descriptor = file_descriptors[process_id].data[ring_file_descriptor_index];
+    if (file_descriptor.type != file_descriptor_type_t::ring) {
+        file_descriptors[process_id].lock.release();
+        return 0;
+    }
+    auto ring_index = file_descriptor.ring_index;
+    file_descriptors[process_id].lock.release();
+    return rings.enter(ring_index, minimum_number_of_completions);
+}
+
+auto descriptor_interface::close_rings(uint64_t process_id) -> void {
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
+        if (file_descriptors[process_id].data[i].type == file_descriptor_type_t::ring) {
+            this->close(process_id, i);
+        }
+    }
+}
+
+auto descriptor_interface::handle_ring_operations() -> void {
+    rings.handle_operations();
+}
+
+auto descriptor_interface::execute_ring_entry(uint64_t process_id, ring_operation_t operation,
+                                              int file_descriptor_index, span_t<byte_t> buffer, size_t offset,
+                                              void **condition_address) -> int64_t {
+    if (file_descriptor_index < 0 ||
+        file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        return -1;
+    }
+    auto &file_descriptor = file_descriptors[process_id].data[file_descriptor_index];
+    auto type = file_descriptor.type;
+    size_t result = 0;
+    switch (operation) {
+    case ring_operation_t::none:
+        return 0;
+    case ring_operation_t::read:
+        if (type == file_descriptor_type_t::inode && offset != SIZE_MAX) {
+            result = this->read_at(process_id, file_descriptor_index, offset, buffer);
+        } else {
+            result = this->read_vector(process_id, file_descriptor_index, span_t(&buffer, 1), false);
+        }
+        break;
+    case ring_operation_t::write:
+        if (type == file_descriptor_type_t::inode && offset != SIZE_MAX) {
+            result = this->write_at(process_id, file_descriptor_index, offset, buffer);
+        } else {
+            result = this->write_vector(process_id, file_descriptor_index, span_t(&buffer, 1), false);
+        }
+        break;
+    case ring_operation_t::receive:
+        if (type != file_descriptor_type_t::socket) {
+            return -1;
+        }
+        result = this->read_vector(process_id, file_descriptor_index, span_t(&buffer, 1), false);
+        break;
+    case ring_operation_t::send:
+        if (type != file_descriptor_type_t::socket) {
+            return -1;
+        }
+        result = this->write_vector(process_id, file_descriptor_index, span_t(&buffer, 1), false);
+        break;
+    case ring_operation_t::accept:
+        result = static_cast<size_t>(this->accept(process_id, file_descriptor_index, false));
+        break;
+    case ring_operation_t::synchronize:
+        return this->synchronize(process_id, file_descriptor_index) ? 0 : -1;
+    default:
+        return -1;
+    }
+    if (result == static_cast<size_t>(synchronization::would_block)) {
+        file_descriptors[process_id].lock.acquire();
+        *condition_address = this->get_readiness(file_descriptors[process_id].data[file_descriptor_index]).condition;
+        file_descriptors[process_id].lock.release();
+    }
+    return static_cast<int64_t>(result);
+}
+
+auto descriptor_interface::synchronize(uint64_t process_id, uint64_t file_descriptor_index) -> bool {
+    if (file_descriptor_index >= descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        file_descriptors[process_id].data[file_descriptor_index].type != file_descriptor_type_t::inode) {
+        return false;
+    }
+    block_cache.open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    block_cache.close_transaction();
+    return true;
+}
+
+auto descriptor_interface::get_readiness(file_descriptor_t &file_descriptor) -> synchronization::readiness_t {
+    synchronization::readiness_t readiness = {};
+    switch (file_descriptor.type) {
+    case file_descriptor_type_t::unused:
+    case file_descriptor_type_t::event_set:
+    case file_descriptor_type_t::ring:
+    case file_descriptor_type_t::shared_memory:
+        break;
+    case file_descriptor_type_t::inode:
+        readiness.readable = true;
+        readiness.writable = true;
+        break;
+    case file_descriptor_type_t::pipe:
+        readiness = pipes.poll(file_descriptor.pipe_index);
+        break;
+    case file_descriptor_type_t::input:
+    case file_descriptor_type_t::output:
+        readiness = device::pl011::get().poll();
+        break;
+    case file_descriptor_type_t::socket:
+        readiness = networking::socket_interface::get().handle_poll_call(file_descriptor.socket_index);
+        break;
+    }
+    readiness.readable = readiness.readable && file_descriptor.readable;
+    readiness.writable = readiness.writable && file_descriptor.writable;
+    return readiness;
+}
+
+auto get_events(synchronization::readiness_t readiness) -> uint16_t {
+    uint16_t events = 0;
+    if (readiness.readable) {
+        events |= descriptor_interface_constants::readable_event;
+    }
+    if (readiness.writable) {
+        events |= descriptor_interface_constants::writable_event;
+    }
+    if (readiness.closed) {
+        events |= descriptor_interface_constants::closed_event;
+    }
+    return events;
+}
+
+auto descriptor_interface::poll_file_descriptors(uint64_t process_id, span_t<poll_descriptor_t> poll_descriptors,
+                                                 span_t<void *> conditions) -> size_t {
+    size_t result = 0;
+    file_descriptors[process_id].lock.acquire();
+    for (size_t i = 0; i < poll_descriptors.size(); i++) {
+        auto &poll_descriptor = poll_descriptors[i];
+        auto file_descriptor_index = poll_descriptor.get_file_descriptor_field();
+        uint16_t events = descriptor_interface_constants::invalid_event;
+        conditions[i] = nullptr;
+        if (file_descriptor_index >= 0 &&
+            file_descriptor_index < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process &&
+            file_descriptors[process_id].data[file_descriptor_index].type != file_descriptor_type_t::unused) {
+            auto readiness = this->get_readiness(file_descriptors[process_id].data[file_descriptor_index]);
+            events = get_events(readiness) &
+                     (poll_descriptor.get_requested_events_field() | descriptor_interface_constants::closed_event);
+            conditions[i] = readiness.condition;
+        }
+        poll_descriptor.set_returned_events_field(events);
+        if (events != 0) {
+            result += 1;
+        }
+    }
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::poll_event_set(uint64_t process_id, int event_set_index,
+                                          span_t<poll_descriptor_t> poll_descriptors, span_t<void *> conditions)
+    -> size_t {
+    auto &event_set = event_sets[event_set_index];
+    size_t result = 0;
+    file_descriptors[process_id].lock.acquire();
+    for (size_t i = 0; i < descriptor_interface_constants::maximum_number_of_file_descriptors_per_process; i++) {
+        event_set_lock.acquire();
+        auto entry = event_set.entries[i];
+        event_set_lock.release();
+        conditions[i] = nullptr;
+        if (entry.file_descriptor_index == -1 ||
+            file_descriptors[process_id].data[entry.file_descriptor_index].type == file_descriptor_type_t::unused) {
+            continue;
+        }
+        auto readiness = this->get_readiness(file_descriptors[process_id].data[entry.file_descriptor_index]);
+        conditions[i] = readiness.condition;
+        auto events = static_cast<uint16_t>(
+            get_events(readiness) & (entry.requested_events | descriptor_interface_constants::closed_event));
+        auto returned_events = events;
+        if ((entry.requested_events & descriptor_interface_constants::edge_triggered_event) != 0) {
+            returned_events = events & ~entry.last_events;
+        }
+        event_set_lock.acquire();
+        if (event_set.entries[i].file_descriptor_index == entry.file_descriptor_index) {
+            event_set.entries[i].last_events = events;
+        }
+        event_set_lock.release();
+        if (returned_events != 0 && result < poll_descriptors.size()) {
+            poll_descriptors[result].set_file_descriptor_field(entry.file_descriptor_index);
+            poll_descriptors[result].set_requested_events_field(entry.requested_events);
+            poll_descriptors[result].set_returned_events_field(returned_events);
+            result += 1;
+        }
+    }
+    file_descriptors[process_id].lock.release();
+    return result;
+}
+
+auto descriptor_interface::reference_event_set(int event_set_index) -> void {
+    event_set_lock.acquire();
+    event_sets[event_set_index].reference_count += 1;
+    event_set_lock.release();
+}
+
+auto descriptor_interface::dereference_event_set(int event_set_index) -> void {
+    event_set_lock.acquire();
+    event_sets[event_set_index].reference_count -= 1;
+    event_set_lock.release();
+}
+
+// Entries are keyed by descriptor index, so a closed index is dropped from every event set the process holds before
+// the index can be reused; the caller holds the descriptor table lock
+auto descriptor_interface::remove_from_event_sets(uint64_t process_id, uint64_t file_descriptor_index) -> void {
+    event_set_lock.acquire();
+    for (auto &file_descriptor : file_descriptors[process_id].data) {
+        if (file_descriptor.type != file_descriptor_type_t::event_set) {
+            continue;
+        }
+        for (auto &entry : event_sets[file_descriptor.event_set_index].entries) {
+            if (entry.file_descriptor_index == static_cast<int>(file_descriptor_index)) {
+                entry = event_set_entry_t{};
+            }
+        }
+    }
+    event_set_lock.release();
 }
 
 auto descriptor_interface::recover() -> void {
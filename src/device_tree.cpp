@@ -0,0 +1,158 @@
+#include "../include/device_tree.hpp"
+#include "../include/architecture.hpp"
+#include "../include/external_types.hpp"
+#include "../include/multiprocessing.hpp"
+#include "../include/symbols.hpp"
+
+namespace device {
+
+auto read_big_endian_word(const byte_t *address) -> uint32_t {
+    uint32_t value = 0;
+    for (size_t i = 0; i < sizeof(uint32_t); i++) {
+        value = (value << 8) | address[i].get_value();
+    }
+    return value;
+}
+
+auto read_cells(const byte_t *address, uint32_t number_of_cells) -> uint64_t {
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < number_of_cells; i++) {
+        value = (value << 32) | read_big_endian_word(address + i * sizeof(uint32_t));
+    }
+    return value;
+}
+
+auto align_to_word(size_t size) -> size_t {
+    return (size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+}
+
+// Returns maximum_length if the string is not terminated within maximum_length bytes
+auto find_string_length(const char *string, size_t maximum_length) -> size_t {
+    size_t length = 0;
+    while (length < maximum_length && string[length] != '\0') {
+        length += 1;
+    }
+    return length;
+}
+
+auto is_equal(const char *string, const char *other_string, bool is_prefix) -> bool {
+    while (*other_string != '\0') {
+        if (*string != *other_string) {
+            return false;
+        }
+        string++;
+        other_string++;
+    }
+    return is_prefix || *string == '\0';
+}
+
+// QEMU hands the blob to the primary core in x0, or leaves it at the base of flash when the kernel occupies the base
+// of RAM; boot.s saves x0 either way
+auto device_tree::get_physical_address() -> uintptr_t {
+    return _device_tree_address_;
+}
+
+auto device_tree::initialize() -> void {
+    if (architecture::get_core_number() == 0) {
+        auto physical_address = device_tree::get_physical_address();
+        const auto *blob = reinterpret_cast<const byte_t *>(
+            memory::kernel_address_space_constants::virtual_address_begin + physical_address);
+        const auto *header = reinterpret_cast<const device_tree_header_t *>(blob);
+        if (header->get_magic_field() != device_tree_magic ||
+            physical_address % memory::section_size + header->get_total_size_field() > device_tree_window_size) {
+            return;
+        }
+        auto memory_size = device_tree::find_memory_size(blob);
+        if (memory_size > memory::kernel_address_space_constants::maximum_physical_address_space_size) {
+            memory_size = memory::kernel_address_space_constants::maximum_physical_address_space_size;
+        }
+        memory_size &= ~(memory::section_size - 1);
+        if (memory_size > device_tree::get().memory_size) {
+            device_tree::get().memory_size = memory_size;
+        }
+    }
+}
+
+auto device_tree::get_memory_size() const -> size_t {
+    return this->memory_size;
+}
+
+// Returns the size of the memory range that begins at physical_address_begin, or 0 if no memory node describes it or
+// the blob is malformed
+auto device_tree::find_memory_size(const byte_t *blob) -> size_t {
+    const auto *header = reinterpret_cast<const device_tree_header_t *>(blob);
+    auto total_size = header->get_total_size_field();
+    auto offset = header->get_structure_offset_field();
+    auto structure_end = offset + header->get_structure_size_field();
+    auto strings_offset = header->get_strings_offset_field();
+    auto strings_size = header->get_strings_size_field();
+    if (offset < device_tree_header_size || structure_end > total_size || strings_offset < device_tree_header_size ||
+        strings_offset + strings_size > total_size) {
+        return 0;
+    }
+    const auto *strings = reinterpret_cast<const char *>(blob + strings_offset);
+    auto address_cells = device_tree_default_address_cells;
+    auto size_cells = device_tree_default_size_cells;
+    auto depth = 0;
+    auto is_memory_node = false;
+    size_t memory_size = 0;
+    while (offset + sizeof(uint32_t) <= structure_end) {
+        auto token = read_big_endian_word(blob + offset);
+        offset += sizeof(uint32_t);
+        if (token == device_tree_begin_node_token) {
+            const auto *name = reinterpret_cast<const char *>(blob + offset);
+            auto name_length = find_string_length(name, structure_end - offset);
+            if (name_length == structure_end - offset) {
+                return 0;
+            }
+            depth += 1;
+            is_memory_node = depth == 2 && is_equal(name, "memory", true);
+            offset += align_to_word(name_length + 1);
+        } else if (token == device_tree_end_node_token) {
+            depth -= 1;
+            is_memory_node = false;
+        } else if (token == device_tree_property_token) {
+            if (offset + 2 * sizeof(uint32_t) > structure_end) {
+                return 0;
+            }
+            auto length = read_big_endian_word(blob + offset);
+            auto name_offset = read_big_endian_word(blob + offset + sizeof(uint32_t));
+            if (offset + 2 * sizeof(uint32_t) + length > structure_end || name_offset >= strings_size ||
+                find_string_length(strings + name_offset, strings_size - name_offset) == strings_size - name_offset) {
+                return 0;
+            }
+            const auto *name = strings + name_offset;
+            const auto *value = blob + offset + 2 * sizeof(uint32_t);
+            offset += 2 * sizeof(uint32_t) + align_to_word(length);
+            if (depth == 1 && is_equal(name, "#address-cells", false)) {
+                if (length != sizeof(uint32_t)) {
+                    return 0;
+                }
+                address_cells = read_big_endian_word(value);
+            } else if (depth == 1 && is_equal(name, "#size-cells", false)) {
+                if (length != sizeof(uint32_t)) {
+                    return 0;
+                }
+                size_cells = read_big_endian_word(value);
+            } else if (is_memory_node && is_equal(name, "reg", false)) {
+                if (address_cells < 1 || address_cells > device_tree_maximum_number_of_cells || size_cells < 1 ||
+                    size_cells > device_tree_maximum_number_of_cells) {
+                    return 0;
+                }
+                auto entry_size = (address_cells + size_cells) * sizeof(uint32_t);
+                for (size_t entry = 0; entry + entry_size <= length; entry += entry_size) {
+                    auto base = read_cells(value + entry, address_cells);
+                    auto size = read_cells(value + entry + address_cells * sizeof(uint32_t), size_cells);
+                    if (base == memory::kernel_address_space_constants::physical_address_begin) {
+                        memory_size = size;
+                    }
+                }
+            }
+        } else if (token != device_tree_nop_token) {
+            break;
+        }
+    }
+    return memory_size;
+}
+
+} // namespace device
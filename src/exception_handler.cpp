@@ -4,6 +4,7 @@
 #include "../include/device.hpp"
 #include "../include/e1000.hpp"
 #include "../include/gicv3.hpp"
+#include "../include/kernel_allocator.hpp"
 #include "../include/multiprocessing.hpp"
 #include "../include/panic.hpp"
 #include "../include/path_name.hpp"
@@ -11,6 +12,7 @@
 #include "../include/socket_interface.hpp"
 #include "../include/thread_scheduler.hpp"
 #include "../include/timer.hpp"
+#include "../include/user_memory.hpp"
 #include "../include/virtio_blk.hpp"
 #include "../include/virtual_memory.hpp"
 
@@ -22,70 +24,258 @@ auto handle_read_system_call(exception_frame_t *exception_frame_pointer) -> void
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto file_descriptor_index = exception_frame_pointer->get_x0_field();
     auto address_of_data_in_user_space = exception_frame_pointer->get_x1_field();
-    auto *address_of_data_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_data_in_user_space).to<byte_t>();
     auto size_of_data = exception_frame_pointer->get_x2_field();
-    auto data_span = span_t(address_of_data_in_kernel_space, size_of_data);
+    auto buffer = memory::acquire_user_buffer(level_0_page_table, address_of_data_in_user_space, size_of_data, true);
+    if (buffer.kernel_span.data() == nullptr && size_of_data != 0) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
+    }
     auto number_of_bytes_read = file::descriptor_interface::get().read(thread_scheduler::get().get_current_process_id(),
-                                                                       file_descriptor_index, data_span);
+                                                                       file_descriptor_index, buffer.kernel_span);
+    if (!memory::release_user_buffer(level_0_page_table, buffer, number_of_bytes_read)) {
+        number_of_bytes_read = 0;
+    }
     exception_frame_pointer->set_x0_field(number_of_bytes_read);
 }
 
+auto write_user_data(memory::page_table_t *level_0_page_table, uint64_t file_descriptor_index, bool has_offset,
+                     size_t offset, uintptr_t address_of_data_in_user_space, size_t size_of_data) -> size_t {
+    size_t number_of_bytes_written = 0;
+    while (number_of_bytes_written < size_of_data) {
+        auto buffer =
+            memory::acquire_user_buffer(level_0_page_table, address_of_data_in_user_space + number_of_bytes_written,
+                                        size_of_data - number_of_bytes_written, false);
+        if (buffer.kernel_span.data() == nullptr) {
+            break;
+        }
+        auto process_id = thread_scheduler::get().get_current_process_id();
+        auto result = has_offset ? file::descriptor_interface::get().write_at(process_id, file_descriptor_index,
+                                                                             offset + number_of_bytes_written,
+                                                                             buffer.kernel_span)
+                                 : file::descriptor_interface::get().write(process_id, file_descriptor_index,
+                                                                          buffer.kernel_span);
+        memory::release_user_buffer(level_0_page_table, buffer, 0);
+        if (result > buffer.kernel_span.size()) {
+            return number_of_bytes_written == 0 ? result : number_of_bytes_written;
+        }
+        number_of_bytes_written += result;
+        if (result < buffer.kernel_span.size()) {
+            break;
+        }
+    }
+    return number_of_bytes_written;
+}
+
 auto handle_write_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto file_descriptor_index = exception_frame_pointer->get_x0_field();
     auto address_of_data_in_user_space = exception_frame_pointer->get_x1_field();
-    auto *address_of_data_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_data_in_user_space).to<byte_t>();
     auto size_of_data = exception_frame_pointer->get_x2_field();
-    auto data_span = span_t(address_of_data_in_kernel_space, size_of_data);
-    auto number_of_bytes_written = file::descriptor_interface::get().write(
-        thread_scheduler::get().get_current_process_id(), file_descriptor_index, data_span);
+    if (size_of_data == 0) {
+        exception_frame_pointer->set_x0_field(file::descriptor_interface::get().write(
+            thread_scheduler::get().get_current_process_id(), file_descriptor_index, span_t<byte_t>{}));
+        return;
+    }
+    auto number_of_bytes_written = write_user_data(level_0_page_table, file_descriptor_index, false, 0,
+                                                   address_of_data_in_user_space, size_of_data);
     exception_frame_pointer->set_x0_field(number_of_bytes_written);
 }
 
-auto handle_exec_system_call(exception_frame_t *exception_frame_pointer) -> void {
+auto handle_read_at_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
-    auto address_of_file_path_in_user_space = exception_frame_pointer->get_x0_field();
-    const auto *address_of_file_path_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_file_path_in_user_space).to<const char>();
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto address_of_data_in_user_space = exception_frame_pointer->get_x1_field();
+    auto size_of_data = exception_frame_pointer->get_x2_field();
+    auto offset = exception_frame_pointer->get_x3_field();
+    auto buffer = memory::acquire_user_buffer(level_0_page_table, address_of_data_in_user_space, size_of_data, true);
+    if (buffer.kernel_span.data() == nullptr) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
+    }
+    auto number_of_bytes_read = file::descriptor_interface::get().read_at(
+        thread_scheduler::get().get_current_process_id(), file_descriptor_index, offset, buffer.kernel_span);
+    if (!memory::release_user_buffer(level_0_page_table, buffer, number_of_bytes_read)) {
+        number_of_bytes_read = 0;
+    }
+    exception_frame_pointer->set_x0_field(number_of_bytes_read);
+}
 
+auto handle_write_at_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto address_of_data_in_user_space = exception_frame_pointer->get_x1_field();
+    auto size_of_data = exception_frame_pointer->get_x2_field();
+    auto offset = exception_frame_pointer->get_x3_field();
+    auto number_of_bytes_written = write_user_data(level_0_page_table, file_descriptor_index, true, offset,
+                                                   address_of_data_in_user_space, size_of_data);
+    exception_frame_pointer->set_x0_field(number_of_bytes_written);
+}
+
+using input_output_buffers_t =
+    array_t<memory::user_buffer_t, file::descriptor_interface_constants::maximum_number_of_input_output_vectors>;
+using input_output_spans_t =
+    array_t<span_t<byte_t>, file::descriptor_interface_constants::maximum_number_of_input_output_vectors>;
+
+auto acquire_input_output_vectors(exception_frame_t *exception_frame_pointer, bool is_written_by_kernel,
+                                  input_output_buffers_t *buffers, input_output_spans_t *spans)
+    -> span_t<span_t<byte_t>> {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_vectors_in_user_space = exception_frame_pointer->get_x1_field();
+    auto number_of_vectors = exception_frame_pointer->get_x2_field();
+    array_t<input_output_vector_t, file::descriptor_interface_constants::maximum_number_of_input_output_vectors>
+        vectors{};
+    if (number_of_vectors > file::descriptor_interface_constants::maximum_number_of_input_output_vectors ||
+        !memory::copy_from_user(level_0_page_table, span_t(&vectors[0], number_of_vectors),
+                                address_of_vectors_in_user_space)) {
+        return span_t<span_t<byte_t>>{};
+    }
+    size_t number_of_acquired_vectors = 0;
+    while (number_of_acquired_vectors < number_of_vectors) {
+        auto &vector = vectors[number_of_acquired_vectors];
+        auto buffer = memory::acquire_user_buffer(level_0_page_table, vector.get_address_field(),
+                                                  vector.get_size_field(), is_written_by_kernel);
+        if (buffer.kernel_span.data() == nullptr && vector.get_size_field() != 0) {
+            break;
+        }
+        (*buffers)[number_of_acquired_vectors] = buffer;
+        (*spans)[number_of_acquired_vectors] = buffer.kernel_span;
+        number_of_acquired_vectors += 1;
+        if (buffer.kernel_span.size() < vector.get_size_field()) {
+            break;
+        }
+    }
+    return span_t(&(*spans)[0], number_of_acquired_vectors);
+}
+
+auto release_input_output_vectors(input_output_buffers_t *buffers, span_t<span_t<byte_t>> spans,
+                                  size_t number_of_bytes_written) -> bool {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto success = true;
+    for (size_t i = 0; i < spans.size(); i++) {
+        auto number_of_bytes_in_vector =
+            number_of_bytes_written < spans[i].size() ? number_of_bytes_written : spans[i].size();
+        success = memory::release_user_buffer(level_0_page_table, (*buffers)[i], number_of_bytes_in_vector) && success;
+        number_of_bytes_written -= number_of_bytes_in_vector;
+    }
+    return success;
+}
+
+auto handle_read_vector_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    input_output_buffers_t buffers{};
+    input_output_spans_t spans{};
+    auto buffers_span = acquire_input_output_vectors(exception_frame_pointer, true, &buffers, &spans);
+    auto number_of_bytes_read = file::descriptor_interface::get().read_vector(
+        thread_scheduler::get().get_current_process_id(), file_descriptor_index, buffers_span);
+    if (!release_input_output_vectors(&buffers, buffers_span, number_of_bytes_read)) {
+        number_of_bytes_read = 0;
+    }
+    exception_frame_pointer->set_x0_field(number_of_bytes_read);
+}
+
+auto handle_write_vector_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    input_output_buffers_t buffers{};
+    input_output_spans_t spans{};
+    auto buffers_span = acquire_input_output_vectors(exception_frame_pointer, false, &buffers, &spans);
+    auto number_of_bytes_written = file::descriptor_interface::get().write_vector(
+        thread_scheduler::get().get_current_process_id(), file_descriptor_index, buffers_span);
+    release_input_output_vectors(&buffers, buffers_span, 0);
+    exception_frame_pointer->set_x0_field(number_of_bytes_written);
+}
+
+using argument_list_t = array_t<array_t<byte_t, memory::page_size> *, memory::page_size / sizeof(uintptr_t)>;
+
+auto free_argument_list(argument_list_t *argument_list) -> void {
+    for (auto *argument : *argument_list) {
+        if (argument != nullptr) {
+            memory::buddy_allocator::get().deallocate(argument);
+        }
+    }
+    memory::buddy_allocator::get().deallocate(argument_list);
+}
+
+auto copy_argument_list(memory::page_table_t *level_0_page_table, uintptr_t address_of_argument_list_in_user_space)
+    -> argument_list_t * {
     auto *address_of_copy_of_argument_list_in_kernel_space =
-        memory::buddy_allocator::get()
-            .allocate<array_t<array_t<byte_t, memory::page_size> *, memory::page_size / sizeof(uintptr_t)>>(0);
+        memory::buddy_allocator::get().allocate<argument_list_t>(0);
     for (size_t i = 0; i < memory::page_size / sizeof(uintptr_t); i++) {
         (*address_of_copy_of_argument_list_in_kernel_space)[i] = nullptr;
     }
+    if (address_of_argument_list_in_user_space == 0) {
+        return address_of_copy_of_argument_list_in_kernel_space;
+    }
 
-    auto address_of_original_argument_list_in_user_space = exception_frame_pointer->get_x1_field();
-    auto *address_of_original_argument_list_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_original_argument_list_in_user_space)
-            .to<array_t<uintptr_t, memory::page_size / sizeof(uintptr_t)>>();
-
-    for (size_t i = 0;
-         (*address_of_original_argument_list_in_kernel_space)[i] != 0 && i < memory::page_size / sizeof(uintptr_t);
-         i++) {
-        auto address_of_original_argument_in_user_space = (*address_of_original_argument_list_in_kernel_space)[i];
-        auto *address_of_original_argument_in_kernel_space =
-            reinterpretable_t<uintptr_t>(level_0_page_table, address_of_original_argument_in_user_space)
-                .to<array_t<byte_t, memory::page_size>>();
-        if (address_of_original_argument_in_kernel_space != nullptr) {
-            (*address_of_copy_of_argument_list_in_kernel_space)[i] = address_of_original_argument_in_kernel_space;
-        } else {
-            // TODO: kill the process
-            panic("exception_handler::handle_exec_system_call, invalid arguments list");
+    // Counts every string with its terminator, like ARG_MAX, so the arguments always fit on the new user stack
+    size_t size_of_arguments = 0;
+    for (int i = 0; i < thread_scheduler_constants::maximum_number_of_arguments; i++) {
+        uintptr_t address_of_original_argument_in_user_space = 0;
+        if (!memory::copy_from_user(level_0_page_table, span_t(&address_of_original_argument_in_user_space, 1),
+                                    address_of_argument_list_in_user_space + i * sizeof(uintptr_t))) {
+            free_argument_list(address_of_copy_of_argument_list_in_kernel_space);
+            return nullptr;
+        }
+        if (address_of_original_argument_in_user_space == 0) {
+            break;
+        }
+        auto *address_of_copy_of_argument_in_kernel_space =
+            memory::buddy_allocator::get().allocate<array_t<byte_t, memory::page_size>>(0);
+        (*address_of_copy_of_argument_list_in_kernel_space)[i] = address_of_copy_of_argument_in_kernel_space;
+        auto argument_span = span_t(&(*address_of_copy_of_argument_in_kernel_space)[0], memory::page_size);
+        if (!memory::copy_string_from_user(level_0_page_table, argument_span,
+                                           address_of_original_argument_in_user_space)) {
+            free_argument_list(address_of_copy_of_argument_list_in_kernel_space);
+            return nullptr;
         }
+        size_t argument_size = 0;
+        while (!argument_span[argument_size].is_zero()) {
+            argument_size += 1;
+        }
+        size_of_arguments += argument_size + 1;
+        if (size_of_arguments > thread_scheduler_constants::maximum_size_of_arguments) {
+            free_argument_list(address_of_copy_of_argument_list_in_kernel_space);
+            return nullptr;
+        }
+    }
+    return address_of_copy_of_argument_list_in_kernel_space;
+}
+
+auto copy_path_name(memory::page_table_t *level_0_page_table, uintptr_t address_of_path_in_user_space,
+                    file::path_name_t *path) -> bool {
+    array_t<char, file::maximum_path_length> path_in_kernel_space{};
+    if (!memory::copy_string_from_user(level_0_page_table,
+                                       as_writable_bytes(span_t(&path_in_kernel_space[0], file::maximum_path_length)),
+                                       address_of_path_in_user_space)) {
+        return false;
+    }
+    *path = file::path_name_t{&path_in_kernel_space[0]};
+    return true;
+}
+
+auto handle_exec_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_file_path_in_user_space = exception_frame_pointer->get_x0_field();
+    file::path_name_t file_path{};
+    if (!copy_path_name(level_0_page_table, address_of_file_path_in_user_space, &file_path)) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
+    }
+    auto *address_of_copy_of_argument_list_in_kernel_space =
+        copy_argument_list(level_0_page_table, exception_frame_pointer->get_x1_field());
+    if (address_of_copy_of_argument_list_in_kernel_space == nullptr) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
     }
 
     auto status = thread_scheduler::get().exec(
-        file::path_name_t{address_of_file_path_in_kernel_space},
+        file_path,
         span_t(&(*address_of_copy_of_argument_list_in_kernel_space)[0], memory::page_size / sizeof(void *)));
     if (!status) {
         exception_frame_pointer->set_x0_field(0);
     } else {
         thread_scheduler::get().yield();
     }
-    memory::buddy_allocator::get().deallocate(address_of_copy_of_argument_list_in_kernel_space);
+    free_argument_list(address_of_copy_of_argument_list_in_kernel_space);
 }
 
 auto handle_fork_system_call(exception_frame_t *exception_frame_pointer) -> void {
@@ -96,10 +286,15 @@ auto handle_fork_system_call(exception_frame_t *exception_frame_pointer) -> void
 auto handle_pipe_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto address_of_file_descriptors_buffer_in_user_space = exception_frame_pointer->get_x0_field();
-    auto *address_of_file_descriptors_buffer_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_file_descriptors_buffer_in_user_space)
-            .to<array_t<int32_t, 2>>();
-    auto result = file::descriptor_interface::get().pipe(address_of_file_descriptors_buffer_in_kernel_space);
+    array_t<int32_t, 2> file_descriptors{};
+    auto result = file::descriptor_interface::get().pipe(&file_descriptors);
+    if (result && !memory::copy_to_user(level_0_page_table, address_of_file_descriptors_buffer_in_user_space,
+                                        span_t(&file_descriptors[0], 2))) {
+        for (auto file_descriptor : file_descriptors) {
+            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
+        }
+        result = false;
+    }
     exception_frame_pointer->set_x0_field(result ? 1 : 0);
 }
 
@@ -115,8 +310,11 @@ auto handle_wait_system_call(exception_frame_t *exception_frame_pointer) -> void
 auto handle_open_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto address_of_path_in_user_space = exception_frame_pointer->get_x0_field();
-    const auto *address_of_path_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_path_in_user_space).to<const char>();
+    file::path_name_t path{};
+    if (!copy_path_name(level_0_page_table, address_of_path_in_user_space, &path)) {
+        exception_frame_pointer->set_x0_field(-1);
+        return;
+    }
     auto readable = exception_frame_pointer->get_x1_field() != 0;
     auto writable = exception_frame_pointer->get_x2_field() != 0;
     file::open_mode_t mode = file::open_mode_t::do_not_create;
@@ -126,8 +324,7 @@ auto handle_open_system_call(exception_frame_t *exception_frame_pointer) -> void
         mode = file::open_mode_t::create_file;
     }
     auto file_descriptor_index = file::descriptor_interface::get().open(
-        thread_scheduler::get().get_current_process_id(), file::path_name_t{address_of_path_in_kernel_space}, readable,
-        writable, mode);
+        thread_scheduler::get().get_current_process_id(), path, readable, writable, mode);
     exception_frame_pointer->set_x0_field(file_descriptor_index);
 }
 
@@ -180,51 +377,290 @@ auto handle_receive_system_call(exception_frame_t *exception_frame_pointer) -> v
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto file_descriptor_index = exception_frame_pointer->get_x0_field();
     auto address_of_buffer_in_user_space = exception_frame_pointer->get_x1_field();
-    auto *address_of_buffer_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_buffer_in_user_space).to<byte_t>();
     auto size = exception_frame_pointer->get_x2_field();
-    auto buffer_span = span_t(address_of_buffer_in_kernel_space, size);
     auto address_of_internet_protocol_address_in_user_space = exception_frame_pointer->get_x3_field();
-    auto *address_of_internet_protocol_address_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_internet_protocol_address_in_user_space)
-            .to<networking::internet_protocol_address_t>();
     auto address_of_port_number_in_user_space = exception_frame_pointer->get_x4_field();
-    auto *address_of_port_number_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_port_number_in_user_space)
-            .to<networking::port_number_t>();
-    if (address_of_buffer_in_kernel_space == nullptr ||
-        (address_of_internet_protocol_address_in_kernel_space == nullptr &&
-         address_of_internet_protocol_address_in_user_space != 0) ||
-        (address_of_port_number_in_kernel_space == nullptr && address_of_port_number_in_user_space != 0)) {
+    auto buffer = memory::acquire_user_buffer(level_0_page_table, address_of_buffer_in_user_space, size, true);
+    if (buffer.kernel_span.data() == nullptr) {
         exception_frame_pointer->set_x0_field(0);
-    } else {
-        auto number_of_bytes_received = file::descriptor_interface::get().receive(
-            file_descriptor_index, buffer_span, address_of_internet_protocol_address_in_kernel_space,
-            address_of_port_number_in_kernel_space);
-        exception_frame_pointer->set_x0_field(number_of_bytes_received);
+        return;
+    }
+    networking::internet_protocol_address_t internet_protocol_address{};
+    networking::port_number_t port_number{};
+    auto number_of_bytes_received = file::descriptor_interface::get().receive(
+        file_descriptor_index, buffer.kernel_span,
+        address_of_internet_protocol_address_in_user_space != 0 ? &internet_protocol_address : nullptr,
+        address_of_port_number_in_user_space != 0 ? &port_number : nullptr);
+    auto success = memory::release_user_buffer(level_0_page_table, buffer, number_of_bytes_received);
+    if (address_of_internet_protocol_address_in_user_space != 0) {
+        success = memory::copy_to_user(level_0_page_table, address_of_internet_protocol_address_in_user_space,
+                                       span_t(&internet_protocol_address, 1)) &&
+                  success;
     }
+    if (address_of_port_number_in_user_space != 0) {
+        success = memory::copy_to_user(level_0_page_table, address_of_port_number_in_user_space,
+                                       span_t(&port_number, 1)) &&
+                  success;
+    }
+    exception_frame_pointer->set_x0_field(success ? number_of_bytes_received : 0);
 }
 
 auto handle_transmit_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto file_descriptor_index = exception_frame_pointer->get_x0_field();
     auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
     auto address_of_buffer_in_user_space = exception_frame_pointer->get_x1_field();
-    auto *address_of_buffer_in_kernel_space =
-        reinterpretable_t<uintptr_t>(level_0_page_table, address_of_buffer_in_user_space).to<byte_t>();
     auto size = exception_frame_pointer->get_x2_field();
-    auto buffer_span = span_t(address_of_buffer_in_kernel_space, size);
     auto internet_protocol_address = exception_frame_pointer->get_x3_field();
     auto port_number = exception_frame_pointer->get_x4_field();
-    if (address_of_buffer_in_kernel_space == nullptr) {
+    auto buffer = memory::acquire_user_buffer(level_0_page_table, address_of_buffer_in_user_space, size, false);
+    if (buffer.kernel_span.data() == nullptr || buffer.kernel_span.size() < size) {
+        memory::release_user_buffer(level_0_page_table, buffer, 0);
         exception_frame_pointer->set_x0_field(0);
     } else {
         auto number_of_bytes_transmitted = file::descriptor_interface::get().transmit(
-            file_descriptor_index, buffer_span, networking::internet_protocol_address_t(internet_protocol_address),
+            file_descriptor_index, buffer.kernel_span,
+            networking::internet_protocol_address_t(internet_protocol_address),
             networking::port_number_t(port_number));
+        memory::release_user_buffer(level_0_page_table, buffer, 0);
         exception_frame_pointer->set_x0_field(number_of_bytes_transmitted);
     }
 }
 
+auto handle_send_file_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto output_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto input_file_descriptor_index = exception_frame_pointer->get_x1_field();
+    auto offset = exception_frame_pointer->get_x2_field();
+    auto size = exception_frame_pointer->get_x3_field();
+    auto number_of_bytes_transmitted =
+        file::descriptor_interface::get().send_file(thread_scheduler::get().get_current_process_id(),
+                                                    output_file_descriptor_index, input_file_descriptor_index, offset,
+                                                    size);
+    exception_frame_pointer->set_x0_field(number_of_bytes_transmitted);
+}
+
+auto handle_splice_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto input_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto output_file_descriptor_index = exception_frame_pointer->get_x1_field();
+    auto size = exception_frame_pointer->get_x2_field();
+    auto number_of_bytes_transferred = file::descriptor_interface::get().splice(
+        thread_scheduler::get().get_current_process_id(), input_file_descriptor_index, output_file_descriptor_index,
+        size);
+    exception_frame_pointer->set_x0_field(number_of_bytes_transferred);
+}
+
+auto handle_tee_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto input_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto output_file_descriptor_index = exception_frame_pointer->get_x1_field();
+    auto size = exception_frame_pointer->get_x2_field();
+    auto number_of_bytes_transferred =
+        file::descriptor_interface::get().tee(thread_scheduler::get().get_current_process_id(),
+                                              input_file_descriptor_index, output_file_descriptor_index, size);
+    exception_frame_pointer->set_x0_field(number_of_bytes_transferred);
+}
+
+auto handle_resize_pipe_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto new_capacity = exception_frame_pointer->get_x1_field();
+    auto capacity = file::descriptor_interface::get().resize_pipe(thread_scheduler::get().get_current_process_id(),
+                                                                  file_descriptor_index, new_capacity);
+    exception_frame_pointer->set_x0_field(capacity);
+}
+
+auto handle_time_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    exception_frame_pointer->set_x0_field(device::timer::now_in_microseconds());
+}
+
+using poll_descriptors_t =
+    array_t<poll_descriptor_t, file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process>;
+
+auto handle_poll_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_poll_descriptors_in_user_space = exception_frame_pointer->get_x0_field();
+    auto number_of_poll_descriptors = exception_frame_pointer->get_x1_field();
+    auto blocking = exception_frame_pointer->get_x2_field() != 0;
+    poll_descriptors_t poll_descriptors{};
+    auto poll_descriptors_span = span_t(&poll_descriptors[0], number_of_poll_descriptors);
+    if (number_of_poll_descriptors >
+            file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        !memory::copy_from_user(level_0_page_table, poll_descriptors_span, address_of_poll_descriptors_in_user_space)) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
+    }
+    auto number_of_ready_descriptors = file::descriptor_interface::get().poll(
+        thread_scheduler::get().get_current_process_id(), poll_descriptors_span, blocking);
+    if (!memory::copy_to_user(level_0_page_table, address_of_poll_descriptors_in_user_space, poll_descriptors_span)) {
+        number_of_ready_descriptors = 0;
+    }
+    exception_frame_pointer->set_x0_field(number_of_ready_descriptors);
+}
+
+auto handle_create_event_set_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto file_descriptor_index =
+        file::descriptor_interface::get().create_event_set(thread_scheduler::get().get_current_process_id());
+    exception_frame_pointer->set_x0_field(file_descriptor_index);
+}
+
+auto handle_control_event_set_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto event_set_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto file_descriptor_index = exception_frame_pointer->get_x1_field();
+    auto operation = static_cast<file::event_set_operation_t>(exception_frame_pointer->get_x2_field());
+    auto events = static_cast<uint16_t>(exception_frame_pointer->get_x3_field());
+    auto success = file::descriptor_interface::get().control_event_set(
+        thread_scheduler::get().get_current_process_id(), event_set_file_descriptor_index, file_descriptor_index,
+        operation, events);
+    exception_frame_pointer->set_x0_field(success ? 1 : 0);
+}
+
+auto handle_wait_event_set_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto event_set_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_poll_descriptors_in_user_space = exception_frame_pointer->get_x1_field();
+    auto number_of_poll_descriptors = exception_frame_pointer->get_x2_field();
+    auto blocking = exception_frame_pointer->get_x3_field() != 0;
+    if (number_of_poll_descriptors >
+        file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process) {
+        exception_frame_pointer->set_x0_field(0);
+        return;
+    }
+    poll_descriptors_t poll_descriptors{};
+    auto poll_descriptors_span = span_t(&poll_descriptors[0], number_of_poll_descriptors);
+    auto number_of_ready_descriptors = file::descriptor_interface::get().wait_event_set(
+        thread_scheduler::get().get_current_process_id(), event_set_file_descriptor_index, poll_descriptors_span,
+        blocking);
+    if (!memory::copy_to_user(level_0_page_table, address_of_poll_descriptors_in_user_space,
+                              span_t(&poll_descriptors[0], number_of_ready_descriptors))) {
+        number_of_ready_descriptors = 0;
+    }
+    exception_frame_pointer->set_x0_field(number_of_ready_descriptors);
+}
+
+auto handle_set_non_blocking_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto non_blocking = exception_frame_pointer->get_x1_field() != 0;
+    auto success = file::descriptor_interface::get().set_non_blocking(thread_scheduler::get().get_current_process_id(),
+                                                                      file_descriptor_index, non_blocking);
+    exception_frame_pointer->set_x0_field(success ? 1 : 0);
+}
+
+auto handle_create_ring_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto flags = static_cast<uint32_t>(exception_frame_pointer->get_x0_field());
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_user_address_in_user_space = exception_frame_pointer->get_x1_field();
+    uintptr_t user_address = 0;
+    if (!memory::copy_to_user(level_0_page_table, address_of_user_address_in_user_space, span_t(&user_address, 1))) {
+        exception_frame_pointer->set_x0_field(-1);
+        return;
+    }
+    auto file_descriptor_index = file::descriptor_interface::get().create_ring(
+        thread_scheduler::get().get_current_process_id(), level_0_page_table, flags, &user_address);
+    if (file_descriptor_index != -1 &&
+        !memory::copy_to_user(level_0_page_table, address_of_user_address_in_user_space, span_t(&user_address, 1))) {
+        file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(),
+                                                file_descriptor_index);
+        file_descriptor_index = -1;
+    }
+    exception_frame_pointer->set_x0_field(file_descriptor_index);
+}
+
+auto handle_enter_ring_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto ring_file_descriptor_index = exception_frame_pointer->get_x0_field();
+    auto minimum_number_of_completions = exception_frame_pointer->get_x1_field();
+    auto number_of_completions = file::descriptor_interface::get().enter_ring(
+        thread_scheduler::get().get_current_process_id(), ring_file_descriptor_index, minimum_number_of_completions);
+    exception_frame_pointer->set_x0_field(number_of_completions);
+}
+
+auto handle_free_memory_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    exception_frame_pointer->set_x0_field(memory::buddy_allocator::get().get_number_of_free_pages() *
+                                          memory::page_size);
+}
+
+auto handle_print_kernel_allocator_statistics_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    memory::print_kernel_allocator_statistics();
+    exception_frame_pointer->set_x0_field(0);
+}
+
+auto handle_brk_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto new_break = exception_frame_pointer->get_x0_field();
+    if (new_break == 0) {
+        auto &current_process = thread_scheduler::get().get_current_process();
+        exception_frame_pointer->set_x0_field(current_process.heap_begin + current_process.heap_size);
+        return;
+    }
+    exception_frame_pointer->set_x0_field(thread_scheduler::get().brk(new_break));
+}
+
+auto handle_sbrk_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto increment = static_cast<int64_t>(exception_frame_pointer->get_x0_field());
+    exception_frame_pointer->set_x0_field(thread_scheduler::get().sbrk(increment));
+}
+
+auto handle_mmap_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto address = exception_frame_pointer->get_x0_field();
+    auto size = exception_frame_pointer->get_x1_field();
+    auto flags = static_cast<uint32_t>(exception_frame_pointer->get_x2_field());
+    auto file_descriptor_index = static_cast<int>(exception_frame_pointer->get_x3_field());
+    auto offset = exception_frame_pointer->get_x4_field();
+    exception_frame_pointer->set_x0_field(
+        thread_scheduler::get().mmap(address, size, flags, file_descriptor_index, offset));
+}
+
+auto handle_munmap_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto address = exception_frame_pointer->get_x0_field();
+    auto size = exception_frame_pointer->get_x1_field();
+    exception_frame_pointer->set_x0_field(thread_scheduler::get().munmap(address, size) ? 0 : -1);
+}
+
+auto handle_msync_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto address = exception_frame_pointer->get_x0_field();
+    auto size = exception_frame_pointer->get_x1_field();
+    exception_frame_pointer->set_x0_field(thread_scheduler::get().msync(address, size) ? 0 : -1);
+}
+
+auto handle_create_shared_memory_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto size = exception_frame_pointer->get_x0_field();
+    auto file_descriptor_index =
+        file::descriptor_interface::get().create_shared_memory(thread_scheduler::get().get_current_process_id(), size);
+    exception_frame_pointer->set_x0_field(file_descriptor_index);
+}
+
+auto handle_vfork_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto child_process_id = thread_scheduler::get().vfork();
+    exception_frame_pointer->set_x0_field(child_process_id);
+}
+
+auto handle_spawn_system_call(exception_frame_t *exception_frame_pointer) -> void {
+    auto *level_0_page_table = thread_scheduler::get().get_current_process().level_0_page_table;
+    auto address_of_file_path_in_user_space = exception_frame_pointer->get_x0_field();
+    auto address_of_file_descriptor_map_in_user_space = exception_frame_pointer->get_x2_field();
+    auto number_of_file_descriptors = exception_frame_pointer->get_x3_field();
+    file::path_name_t file_path{};
+    array_t<int32_t, file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process>
+        file_descriptor_map{};
+    auto file_descriptor_map_span = span_t(&file_descriptor_map[0], number_of_file_descriptors);
+    if (number_of_file_descriptors >
+            file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+        !copy_path_name(level_0_page_table, address_of_file_path_in_user_space, &file_path) ||
+        !memory::copy_from_user(level_0_page_table, file_descriptor_map_span,
+                                address_of_file_descriptor_map_in_user_space)) {
+        exception_frame_pointer->set_x0_field(-1);
+        return;
+    }
+    auto *address_of_copy_of_argument_list_in_kernel_space =
+        copy_argument_list(level_0_page_table, exception_frame_pointer->get_x1_field());
+    if (address_of_copy_of_argument_list_in_kernel_space == nullptr) {
+        exception_frame_pointer->set_x0_field(-1);
+        return;
+    }
+
+    auto child_process_id = thread_scheduler::get().spawn(
+        file_path,
+        span_t(&(*address_of_copy_of_argument_list_in_kernel_space)[0], memory::page_size / sizeof(void *)),
+        file_descriptor_map_span);
+    exception_frame_pointer->set_x0_field(child_process_id);
+    free_argument_list(address_of_copy_of_argument_list_in_kernel_space);
+}
+
 auto handle_system_call(exception_frame_t *exception_frame_pointer) -> void {
     auto system_call_number = exception_frame_pointer->get_x8_field();
     switch (system_call_number) {
@@ -282,6 +718,84 @@ auto handle_system_call(exception_frame_t *exception_frame_pointer) -> void {
     case exception_handler_constants::system_call_numbers::transmit:
         handle_transmit_system_call(exception_frame_pointer);
         break;
+    case exception_handler_constants::system_call_numbers::read_at:
+        handle_read_at_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::write_at:
+        handle_write_at_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::read_vector:
+        handle_read_vector_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::write_vector:
+        handle_write_vector_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::send_file:
+        handle_send_file_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::splice:
+        handle_splice_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::tee:
+        handle_tee_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::resize_pipe:
+        handle_resize_pipe_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::time:
+        handle_time_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::poll:
+        handle_poll_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::create_event_set:
+        handle_create_event_set_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::control_event_set:
+        handle_control_event_set_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::wait_event_set:
+        handle_wait_event_set_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::set_non_blocking:
+        handle_set_non_blocking_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::create_ring:
+        handle_create_ring_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::enter_ring:
+        handle_enter_ring_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::free_memory:
+        handle_free_memory_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::brk:
+        handle_brk_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::sbrk:
+        handle_sbrk_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::mmap:
+        handle_mmap_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::munmap:
+        handle_munmap_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::msync:
+        handle_msync_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::create_shared_memory:
+        handle_create_shared_memory_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::vfork:
+        handle_vfork_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::spawn:
+        handle_spawn_system_call(exception_frame_pointer);
+        break;
+    case exception_handler_constants::system_call_numbers::print_kernel_allocator_statistics:
+        handle_print_kernel_allocator_statistics_system_call(exception_frame_pointer);
+        break;
     default:
         panic("exception_handler::handle_system_call");
     }
@@ -320,6 +834,11 @@ extern "C" void handle_exception_level_0_exception(exception_frame_t *exception_
 
     if (exception_class == architecture::svc_exception_code) {
         handle_system_call(exception_frame_pointer);
+    } else if ((exception_class == architecture::lower_exception_level_instruction_abort_exception_code ||
+                exception_class == architecture::lower_exception_level_data_abort_exception_code) &&
+               thread_scheduler::get().resolve_page_fault(
+                   thread_scheduler::get().get_current_process().level_0_page_table, far_el1_value)) {
+        return;
     } else {
         panic("exception_handler::handle_exception_level_0_exception");
     }
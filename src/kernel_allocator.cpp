@@ -0,0 +1,110 @@
+#include "../include/kernel_allocator.hpp"
+#include "../include/buddy_allocator.hpp"
+#include "../include/panic.hpp"
+#include "../include/pl011.hpp"
+#include "../include/slab_allocator.hpp"
+
+namespace memory {
+
+array_t<kernel_allocator_statistics_t, kernel_allocator_constants::number_of_size_classes + 1>
+    kernel_allocator_statistics{};
+
+template <int size_class> auto allocate_from_size_class(int index) -> byte_t * {
+    if (index == size_class) {
+        using block_t = kernel_allocation_block_t<get_size_of_size_class(size_class)>;
+        return &slab_allocator<block_t>::get().allocate()->bytes[0];
+    }
+    if constexpr (size_class + 1 < kernel_allocator_constants::number_of_size_classes) {
+        return allocate_from_size_class<size_class + 1>(index);
+    }
+    panic("allocate_from_size_class");
+}
+
+template <int size_class> auto deallocate_to_size_class(int index, byte_t *address) -> void {
+    if (index == size_class) {
+        using block_t = kernel_allocation_block_t<get_size_of_size_class(size_class)>;
+        slab_allocator<block_t>::get().deallocate(reinterpret_cast<block_t *>(address));
+        return;
+    }
+    if constexpr (size_class + 1 < kernel_allocator_constants::number_of_size_classes) {
+        deallocate_to_size_class<size_class + 1>(index, address);
+        return;
+    }
+    panic("deallocate_to_size_class");
+}
+
+auto kmalloc(size_t size) -> void * {
+    if (size > kernel_address_space_constants::maximum_physical_address_space_size) {
+        return nullptr;
+    }
+    auto total_size = sizeof(kernel_allocation_header_t) + size;
+    uint32_t size_class = 0;
+    while (size_class < kernel_allocator_constants::number_of_size_classes &&
+           get_size_of_size_class(static_cast<int>(size_class)) < total_size) {
+        size_class += 1;
+    }
+    byte_t *block_address = nullptr;
+    uint32_t order = 0;
+    if (size_class < kernel_allocator_constants::number_of_size_classes) {
+        block_address = allocate_from_size_class<0>(static_cast<int>(size_class));
+    } else {
+        while ((page_size << order) < total_size) {
+            order += 1;
+        }
+        auto block = buddy_allocator::get().allocate_if_available(static_cast<int>(order));
+        if (block.size() == 0) {
+            return nullptr;
+        }
+        block_address = block.data();
+    }
+    auto *header = reinterpret_cast<kernel_allocation_header_t *>(block_address);
+    header->size_class = size_class;
+    header->order = order;
+    header->size = size;
+    auto &statistics = kernel_allocator_statistics[size_class];
+    __atomic_add_fetch(&statistics.number_of_allocations, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&statistics.number_of_bytes_requested, size, __ATOMIC_RELAXED);
+    return header + 1;
+}
+
+auto kfree(void *address) -> void {
+    if (address == nullptr) {
+        return;
+    }
+    auto *header = static_cast<kernel_allocation_header_t *>(address) - 1;
+    if (header->size_class > kernel_allocator_constants::number_of_size_classes) {
+        panic("kfree");
+    }
+    auto &statistics = kernel_allocator_statistics[header->size_class];
+    __atomic_add_fetch(&statistics.number_of_deallocations, 1, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&statistics.number_of_bytes_requested, header->size, __ATOMIC_RELAXED);
+    if (header->size_class == kernel_allocator_constants::number_of_size_classes) {
+        buddy_allocator::get().deallocate(header);
+    } else {
+        deallocate_to_size_class<0>(static_cast<int>(header->size_class), reinterpret_cast<byte_t *>(header));
+    }
+}
+
+auto get_kernel_allocator_statistics(int size_class) -> kernel_allocator_statistics_t {
+    auto &statistics = kernel_allocator_statistics[size_class];
+    kernel_allocator_statistics_t snapshot{};
+    snapshot.number_of_allocations = __atomic_load_n(&statistics.number_of_allocations, __ATOMIC_RELAXED);
+    snapshot.number_of_deallocations = __atomic_load_n(&statistics.number_of_deallocations, __ATOMIC_RELAXED);
+    snapshot.number_of_bytes_requested = __atomic_load_n(&statistics.number_of_bytes_requested, __ATOMIC_RELAXED);
+    return snapshot;
+}
+
+auto print_kernel_allocator_statistics() -> void {
+    for (int size_class = 0; size_class <= kernel_allocator_constants::number_of_size_classes; size_class++) {
+        auto statistics = get_kernel_allocator_statistics(size_class);
+        if (size_class < kernel_allocator_constants::number_of_size_classes) {
+            device::pl011::printf("kmalloc %d: ", get_size_of_size_class(size_class));
+        } else {
+            device::pl011::printf("kmalloc large: ");
+        }
+        device::pl011::printf("%d allocations, %d frees, %d bytes in use\n", statistics.number_of_allocations,
+                              statistics.number_of_deallocations, statistics.number_of_bytes_requested);
+    }
+}
+
+} // namespace memory
@@ -0,0 +1,123 @@
+#include "../include/page_cache.hpp"
+
+namespace file {
+
+page_cache_t::page_cache_t(block_cache_t *block_cache, inode_cache_t *inode_cache)
+    : block_cache(block_cache), inode_cache(inode_cache) {}
+
+auto page_cache_t::acquire(inode_index_t index_of_inode_on_disk, size_t page_index) -> memory::page_t * {
+    lock.acquire();
+    cached_page_t *unused_cached_page = nullptr;
+    for (auto &cached_page : pages) {
+        if (cached_page.page != nullptr && cached_page.index_of_inode_on_disk == index_of_inode_on_disk &&
+            cached_page.page_index == page_index) {
+            memory::buddy_allocator::get().reference(cached_page.page);
+            lock.release();
+            return cached_page.page;
+        }
+        if (cached_page.page == nullptr && unused_cached_page == nullptr) {
+            unused_cached_page = &cached_page;
+        }
+    }
+    if (unused_cached_page == nullptr) {
+        for (auto &cached_page : pages) {
+            if (!cached_page.dirty && memory::buddy_allocator::get().get_reference_count(cached_page.page) == 1) {
+                memory::buddy_allocator::get().deallocate(cached_page.page);
+                cached_page = cached_page_t();
+                unused_cached_page = &cached_page;
+                break;
+            }
+        }
+    }
+    if (unused_cached_page == nullptr) {
+        lock.release();
+        return nullptr;
+    }
+    auto *page = memory::buddy_allocator::get().allocate_zeroed<memory::page_t>(0);
+    block_cache->open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    inode_cache->read(index_of_inode_on_disk, page_index * memory::page_size, span_t(&(*page)[0], memory::page_size));
+    block_cache->close_transaction();
+    unused_cached_page->index_of_inode_on_disk = index_of_inode_on_disk;
+    unused_cached_page->page_index = page_index;
+    unused_cached_page->page = page;
+    unused_cached_page->dirty = false;
+    memory::buddy_allocator::get().reference(page);
+    lock.release();
+    return page;
+}
+
+auto page_cache_t::mark_dirty(inode_index_t index_of_inode_on_disk, size_t page_index) -> void {
+    lock.acquire();
+    for (auto &cached_page : pages) {
+        if (cached_page.page != nullptr && cached_page.index_of_inode_on_disk == index_of_inode_on_disk &&
+            cached_page.page_index == page_index) {
+            cached_page.dirty = true;
+            break;
+        }
+    }
+    lock.release();
+}
+
+auto page_cache_t::synchronize(inode_index_t index_of_inode_on_disk, size_t first_page_index, size_t number_of_pages)
+    -> void {
+    lock.acquire();
+    for (auto &cached_page : pages) {
+        if (cached_page.page == nullptr || cached_page.index_of_inode_on_disk != index_of_inode_on_disk ||
+            cached_page.page_index < first_page_index || cached_page.page_index >= first_page_index + number_of_pages) {
+            continue;
+        }
+        if (cached_page.dirty) {
+            this->write_back(cached_page);
+        }
+        if (memory::buddy_allocator::get().get_reference_count(cached_page.page) == 1) {
+            memory::buddy_allocator::get().deallocate(cached_page.page);
+            cached_page = cached_page_t();
+        }
+    }
+    lock.release();
+}
+
+auto page_cache_t::update(inode_index_t index_of_inode_on_disk, size_t offset, span_t<byte_t> buffer) -> void {
+    lock.acquire();
+    for (auto &cached_page : pages) {
+        if (cached_page.page == nullptr || cached_page.index_of_inode_on_disk != index_of_inode_on_disk) {
+            continue;
+        }
+        auto page_offset = cached_page.page_index * memory::page_size;
+        auto overlap_begin = offset > page_offset ? offset : page_offset;
+        auto overlap_end = offset + buffer.size() < page_offset + memory::page_size ? offset + buffer.size()
+                                                                                     : page_offset + memory::page_size;
+        for (auto i = overlap_begin; i < overlap_end; i++) {
+            (*cached_page.page)[i - page_offset] = buffer[i - offset];
+        }
+    }
+    lock.release();
+}
+
+auto page_cache_t::invalidate(inode_index_t index_of_inode_on_disk) -> void {
+    lock.acquire();
+    for (auto &cached_page : pages) {
+        if (cached_page.page != nullptr && cached_page.index_of_inode_on_disk == index_of_inode_on_disk &&
+            memory::buddy_allocator::get().get_reference_count(cached_page.page) == 1) {
+            memory::buddy_allocator::get().deallocate(cached_page.page);
+            cached_page = cached_page_t();
+        }
+    }
+    lock.release();
+}
+
+auto page_cache_t::write_back(cached_page_t &cached_page) -> void {
+    block_cache->open_transaction(descriptor_interface_constants::maximum_number_of_changed_blocks_per_transaction);
+    auto file_size = inode_cache->status(cached_page.index_of_inode_on_disk).size;
+    auto page_offset = cached_page.page_index * memory::page_size;
+    if (page_offset < file_size) {
+        auto size = file_size - page_offset < memory::page_size ? file_size - page_offset : memory::page_size;
+        inode_cache->write(cached_page.index_of_inode_on_disk, page_offset, span_t(&(*cached_page.page)[0], size));
+    }
+    block_cache->close_transaction();
+    if (memory::buddy_allocator::get().get_reference_count(cached_page.page) == 1) {
+        cached_page.dirty = false;
+    }
+}
+
+} // namespace file
@@ -25,7 +25,7 @@ page_table_descriptor_t::page_table_descriptor_t(uintptr_t table_address) : valu
 
 page_table_descriptor_t::page_table_descriptor_t(uintptr_t page_address, bool is_device_memory, bool is_read_only,
                                                  bool is_privileged_only, bool is_privileged_executable,
-                                                 bool is_unprivileged_executable)
+                                                 bool is_unprivileged_executable, bool is_copy_on_write)
     : value{0b11} {
     if (is_device_memory) {
         this->set_attrindx_bits(0b000);
@@ -48,7 +48,7 @@ page_table_descriptor_t::page_table_descriptor_t(uintptr_t page_address, bool is
     }
     this->set_sh_bits(0b00);
     this->set_af_bit(true);
-    this->set_ng_bit(false);
+    this->set_ng_bit(!is_privileged_only);
     this->set_output_address_bits(page_address);
     this->set_dbm_bit(false);
     this->set_contiguous_bit(false);
@@ -62,12 +62,45 @@ page_table_descriptor_t::page_table_descriptor_t(uintptr_t page_address, bool is
     } else {
         this->set_uxn_bit(true);
     }
+    this->set_copy_on_write_bit(is_copy_on_write);
 }
 
 [[nodiscard]] auto page_table_descriptor_t::is_valid() const -> bool {
     return (this->value & 1) == 1;
 }
 
+[[nodiscard]] auto page_table_descriptor_t::is_copy_on_write() const -> bool {
+    return this->is_valid() && this->get_copy_on_write_bit();
+}
+
+[[nodiscard]] auto page_table_descriptor_t::is_user_writable() const -> bool {
+    return this->is_valid() && this->get_ap_bits() == 0b01;
+}
+
+[[nodiscard]] auto page_table_descriptor_t::is_block() const -> bool {
+    return this->is_valid() && !this->get_table_bit();
+}
+
+[[nodiscard]] auto page_table_descriptor_t::get_block_descriptor() const -> page_table_descriptor_t {
+    auto block_descriptor = *this;
+    block_descriptor.set_table_bit(false);
+    return block_descriptor;
+}
+
+[[nodiscard]] auto page_table_descriptor_t::get_page_descriptor(uintptr_t page_address) const
+    -> page_table_descriptor_t {
+    auto page_descriptor = *this;
+    page_descriptor.set_table_bit(true);
+    page_descriptor.set_output_address_bits(page_address);
+    return page_descriptor;
+}
+
+[[nodiscard]] auto page_table_descriptor_t::get_contiguous_descriptor() const -> page_table_descriptor_t {
+    auto contiguous_descriptor = *this;
+    contiguous_descriptor.set_contiguous_bit(true);
+    return contiguous_descriptor;
+}
+
 [[nodiscard]] auto page_table_descriptor_t::get_next_level_table_address() const -> page_table_t * {
     return reinterpret_cast<page_table_t *>(memory::kernel_address_space_constants::virtual_address_begin |
                                             this->get_next_level_table_address_bits());
@@ -77,6 +110,18 @@ page_table_descriptor_t::page_table_descriptor_t(uintptr_t page_address, bool is
     return this->get_output_address_bits();
 }
 
+[[nodiscard]] auto page_table_descriptor_t::get_table_bit() const -> bool {
+    constexpr auto offset = 1;
+    constexpr uint64_t mask = 0b1;
+    return (this->value & (mask << offset)) != 0;
+}
+
+auto page_table_descriptor_t::set_table_bit(bool value) -> void {
+    constexpr auto offset = 1;
+    constexpr uint64_t mask = 0b1;
+    value ? this->value |= mask << offset : this->value &= ~(mask << offset);
+}
+
 [[nodiscard]] auto page_table_descriptor_t::get_next_level_table_address_bits() const -> uintptr_t {
     constexpr auto offset = 12;
     constexpr uint64_t mask = 0b111111111111111111111111111111111111;
@@ -269,6 +314,18 @@ auto page_table_descriptor_t::set_uxn_bit(bool value) -> void {
     value ? this->value |= mask << offset : this->value &= ~(mask << offset);
 }
 
+[[nodiscard]] auto page_table_descriptor_t::get_copy_on_write_bit() const -> bool {
+    constexpr auto offset = 55;
+    constexpr uint64_t mask = 0b1;
+    return (this->value & (mask << offset)) != 0;
+}
+
+auto page_table_descriptor_t::set_copy_on_write_bit(bool value) -> void {
+    constexpr auto offset = 55;
+    constexpr uint64_t mask = 0b1;
+    value ? this->value |= mask << offset : this->value &= ~(mask << offset);
+}
+
 auto get_level_0_page_table_index(uintptr_t value) -> size_t {
     return (value & (memory::virtual_memory_constants::virtual_address_field_mask::level_0_page_table_index
                      << memory::virtual_memory_constants::virtual_address_field_offset::level_0_page_table_index)) >>
@@ -311,42 +368,107 @@ auto page_table_t::get_address_of_descriptor_at_index(size_t index) -> page_tabl
 
 auto page_table_t::translate(uintptr_t virtual_address) -> uintptr_t {
     auto *page_descriptor = this->walk(virtual_address, mode_t::do_not_create);
-    if (page_descriptor == nullptr) {
+    if (page_descriptor == nullptr || !page_descriptor->is_valid()) {
         return 0;
     }
+    if (page_descriptor->is_block()) {
+        return page_descriptor->get_output_address_upper_bits() | (virtual_address & (section_size - 1));
+    }
     return page_descriptor->get_output_address_upper_bits() | get_output_address_lower_bits(virtual_address);
 }
 
-auto page_table_t::map(uintptr_t virtual_address, type_t type, uintptr_t physical_address, std::size_t size) -> void {
-    for (size_t offset = 0; offset < size; offset += page_size) {
-        page_table_descriptor_t *page_descriptor = nullptr;
-        switch (type) {
-        case page_table_t::type_t::device:
-        case page_table_t::type_t::text:
-        case page_table_t::type_t::data:
-            page_descriptor = this->walk(virtual_address + offset, mode_t::create_el1_mapping);
-            break;
-        case page_table_t::type_t::user:
-            page_descriptor = this->walk(virtual_address + offset, mode_t::create_el0_mapping);
+auto get_descriptor_of_type(page_table_t::type_t type, uintptr_t physical_address) -> page_table_descriptor_t {
+    switch (type) {
+    case page_table_t::type_t::device:
+        return {physical_address, true, false, true, true, true};
+    case page_table_t::type_t::text:
+        return {physical_address, false, true, true, true, false};
+    case page_table_t::type_t::data:
+        return {physical_address, false, false, true, false, false};
+    case page_table_t::type_t::user:
+        return {physical_address, false, false, false, true, true};
+    case page_table_t::type_t::read_only:
+        return {physical_address, false, true, false, true, true};
+    case page_table_t::type_t::copy_on_write:
+        return {physical_address, false, true, false, true, true, true};
+    }
+    return {};
+}
+
+auto get_mode_of_type(page_table_t::type_t type) -> page_table_t::mode_t {
+    if (type == page_table_t::type_t::device || type == page_table_t::type_t::text ||
+        type == page_table_t::type_t::data) {
+        return page_table_t::mode_t::create_el1_mapping;
+    }
+    return page_table_t::mode_t::create_el0_mapping;
+}
+
+auto get_section_end(uintptr_t virtual_address) -> uintptr_t {
+    return (virtual_address | (section_size - 1)) + 1;
+}
+
+auto page_table_t::translate_range(uintptr_t virtual_address, size_t size, span_t<physical_range_t> ranges,
+                                   bool is_write) -> size_t {
+    page_table_walker_t walker(this, mode_t::do_not_create);
+    size_t number_of_ranges = 0;
+    size_t offset = 0;
+    while (offset < size) {
+        auto *page_descriptor = walker.walk(virtual_address + offset);
+        if (page_descriptor == nullptr || !page_descriptor->is_valid() ||
+            (is_write && !page_descriptor->is_user_writable())) {
             break;
         }
-        if (page_descriptor == nullptr) {
-            panic("page_table::map");
+        auto mapping_size = page_descriptor->is_block() ? section_size : page_size;
+        auto offset_in_mapping = (virtual_address + offset) & (mapping_size - 1);
+        auto physical_address = page_descriptor->get_output_address_upper_bits() | offset_in_mapping;
+        auto chunk_size = mapping_size - offset_in_mapping;
+        if (chunk_size > size - offset) {
+            chunk_size = size - offset;
         }
-        switch (type) {
-        case type_t::device:
-            *page_descriptor = page_table_descriptor_t(physical_address + offset, true, false, true, true, true);
-            break;
-        case type_t::text:
-            *page_descriptor = page_table_descriptor_t(physical_address + offset, false, true, true, true, false);
-            break;
-        case type_t::data:
-            *page_descriptor = page_table_descriptor_t(physical_address + offset, false, false, true, false, false);
-            break;
-        case type_t::user:
-            *page_descriptor = page_table_descriptor_t(physical_address + offset, false, false, false, true, true);
+        if (number_of_ranges > 0 &&
+            ranges[number_of_ranges - 1].address + ranges[number_of_ranges - 1].size == physical_address) {
+            ranges[number_of_ranges - 1].size += chunk_size;
+        } else if (number_of_ranges < ranges.size()) {
+            ranges[number_of_ranges] = {physical_address, chunk_size};
+            number_of_ranges += 1;
+        } else {
             break;
         }
+        offset += chunk_size;
+    }
+    return number_of_ranges;
+}
+
+auto page_table_t::map(uintptr_t virtual_address, type_t type, uintptr_t physical_address, std::size_t size) -> void {
+    auto mode = get_mode_of_type(type);
+    page_table_walker_t walker(this, mode);
+    size_t offset = 0;
+    while (offset < size) {
+        if ((virtual_address + offset) % section_size == 0 && (physical_address + offset) % section_size == 0 &&
+            size - offset >= section_size) {
+            auto *block_descriptor = this->walk_to_level_2(virtual_address + offset, mode);
+            if (!block_descriptor->is_valid() || block_descriptor->is_block()) {
+                *block_descriptor = get_descriptor_of_type(type, physical_address + offset).get_block_descriptor();
+                offset += section_size;
+                continue;
+            }
+        }
+        auto is_contiguous = mode == mode_t::create_el1_mapping &&
+                             (virtual_address + offset) % contiguous_range_size == 0 &&
+                             (physical_address + offset) % contiguous_range_size == 0 &&
+                             size - offset >= contiguous_range_size;
+        auto number_of_pages = is_contiguous ? contiguous_range_size / page_size : 1;
+        for (size_t i = 0; i < number_of_pages; i++) {
+            auto *page_descriptor = walker.walk(virtual_address + offset);
+            if (page_descriptor == nullptr) {
+                panic("page_table::map");
+            }
+            *page_descriptor = get_descriptor_of_type(type, physical_address + offset);
+            if (is_contiguous) {
+                *page_descriptor = page_descriptor->get_contiguous_descriptor();
+            }
+            offset += page_size;
+        }
     }
 }
 
@@ -358,17 +480,253 @@ auto page_table_t::map(uintptr_t virtual_address, type_t type, void (*physical_a
     this->map(virtual_address, type, reinterpretable_t<void (*)()>(physical_address).to_integer(), size);
 }
 
+auto page_table_t::map(uintptr_t virtual_address, type_t type, span_t<page_t *> pages) -> void {
+    page_table_walker_t walker(this, get_mode_of_type(type));
+    for (size_t i = 0; i < pages.size(); i++) {
+        auto *page_descriptor = walker.walk(virtual_address + i * page_size);
+        if (page_descriptor == nullptr) {
+            panic("page_table::map");
+        }
+        *page_descriptor = get_descriptor_of_type(type, reinterpretable_t<void *>(pages[i]).to_integer());
+    }
+}
+
 auto page_table_t::unmap(uintptr_t virtual_address, size_t size) -> void {
-    for (size_t offset = 0; offset < size; offset += page_size) {
-        auto *page_descriptor = this->walk(virtual_address + offset, mode_t::do_not_create);
+    page_table_walker_t walker(this, mode_t::do_not_create);
+    size_t offset = 0;
+    while (offset < size) {
+        auto *page_descriptor = walker.walk(virtual_address + offset);
         if (page_descriptor == nullptr) {
             panic("page_table::unmap");
         }
+        if (page_descriptor->is_block()) {
+            if ((virtual_address + offset) % section_size == 0 && size - offset >= section_size) {
+                *page_descriptor = page_table_descriptor_t();
+                offset += section_size;
+                continue;
+            }
+            this->split_block(page_descriptor);
+            page_descriptor = walker.walk(virtual_address + offset);
+        }
         *page_descriptor = page_table_descriptor_t();
+        offset += page_size;
     }
+    virtual_memory::flush_translation_lookaside_buffer(this);
+}
+
+auto page_table_t::release(uintptr_t virtual_address, size_t size) -> void {
+    page_table_walker_t walker(this, mode_t::do_not_create);
+    size_t offset = 0;
+    while (offset < size) {
+        auto *page_descriptor = walker.walk(virtual_address + offset);
+        if (page_descriptor == nullptr) {
+            offset = get_section_end(virtual_address + offset) - virtual_address;
+            continue;
+        }
+        if (!page_descriptor->is_valid()) {
+            offset += page_size;
+            continue;
+        }
+        auto *page = reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin +
+                                                page_descriptor->get_output_address_upper_bits());
+        if (page_descriptor->is_block()) {
+            if ((virtual_address + offset) % section_size == 0 && size - offset >= section_size) {
+                if (buddy_allocator::get().contains(page)) {
+                    buddy_allocator::get().deallocate(page);
+                }
+                *page_descriptor = page_table_descriptor_t();
+                offset += section_size;
+                continue;
+            }
+            this->split_block(page_descriptor);
+            page_descriptor = walker.walk(virtual_address + offset);
+            page = reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin +
+                                              page_descriptor->get_output_address_upper_bits());
+        }
+        if (buddy_allocator::get().contains(page)) {
+            buddy_allocator::get().deallocate(page);
+        }
+        *page_descriptor = page_table_descriptor_t();
+        offset += page_size;
+    }
+    virtual_memory::flush_translation_lookaside_buffer(this);
+}
+
+auto page_table_t::share(page_table_t *destination_page_table, uintptr_t virtual_address, size_t size,
+                         bool copy_on_write) -> void {
+    page_table_walker_t walker(this, mode_t::do_not_create);
+    page_table_walker_t destination_walker(destination_page_table, mode_t::create_el0_mapping);
+    size_t offset = 0;
+    while (offset < size) {
+        auto *page_descriptor = walker.walk(virtual_address + offset);
+        if (page_descriptor == nullptr) {
+            offset = get_section_end(virtual_address + offset) - virtual_address;
+            continue;
+        }
+        if (!page_descriptor->is_valid()) {
+            offset += page_size;
+            continue;
+        }
+        auto page_physical_address = page_descriptor->get_output_address_upper_bits();
+        auto *page = reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin +
+                                                page_physical_address);
+        if (page_descriptor->is_block()) {
+            if ((virtual_address + offset) % section_size == 0 && size - offset >= section_size &&
+                buddy_allocator::get().contains(page)) {
+                auto type = copy_on_write ? type_t::copy_on_write : type_t::read_only;
+                buddy_allocator::get().reference(page);
+                if (copy_on_write) {
+                    this->map(virtual_address + offset, type, page_physical_address, section_size);
+                }
+                destination_page_table->map(virtual_address + offset, type, page_physical_address, section_size);
+                offset += section_size;
+                continue;
+            }
+            this->split_block(page_descriptor);
+            page_descriptor = walker.walk(virtual_address + offset);
+            page_physical_address = page_descriptor->get_output_address_upper_bits();
+            page = reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin +
+                                              page_physical_address);
+        }
+        auto *destination_page_descriptor = destination_walker.walk(virtual_address + offset);
+        if (buddy_allocator::get().contains(page) && !copy_on_write) {
+            buddy_allocator::get().reference(page);
+            *destination_page_descriptor = get_descriptor_of_type(type_t::read_only, page_physical_address);
+        } else if (buddy_allocator::get().contains(page)) {
+            buddy_allocator::get().reference(page);
+            *page_descriptor = get_descriptor_of_type(type_t::copy_on_write, page_physical_address);
+            *destination_page_descriptor = *page_descriptor;
+        } else {
+            auto *new_page = buddy_allocator::get().allocate<page_t>(0);
+            *new_page = *page;
+            *destination_page_descriptor =
+                get_descriptor_of_type(type_t::user, reinterpretable_t<void *>(new_page).to_integer());
+        }
+        offset += page_size;
+    }
+    virtual_memory::flush_translation_lookaside_buffer(this);
+}
+
+auto page_table_t::resolve_copy_on_write(uintptr_t virtual_address) -> bool {
+    auto *page_descriptor = this->walk(virtual_address, mode_t::do_not_create);
+    if (page_descriptor == nullptr || !page_descriptor->is_copy_on_write()) {
+        return false;
+    }
+    auto page_virtual_address = virtual_address & ~(page_size - 1);
+    auto page_physical_address = page_descriptor->get_output_address_upper_bits();
+    auto *page =
+        reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin + page_physical_address);
+    if (page_descriptor->is_block()) {
+        auto section_virtual_address = virtual_address & ~(section_size - 1);
+        if (buddy_allocator::get().get_reference_count(page) == 1) {
+            this->map(section_virtual_address, type_t::user, page_physical_address, section_size);
+            virtual_memory::flush_translation_lookaside_buffer(this, section_virtual_address);
+            return true;
+        }
+        auto new_block = buddy_allocator::get().allocate_if_available(buddy_allocator_constants::section_order);
+        if (new_block.size() != 0) {
+            auto *new_pages = reinterpretable_t<span_t<byte_t>>(new_block).to<page_t>();
+            for (size_t i = 0; i < section_size / page_size; i++) {
+                new_pages[i] = page[i];
+            }
+            this->map(section_virtual_address, type_t::user, new_pages, section_size);
+            buddy_allocator::get().deallocate(page);
+            virtual_memory::flush_translation_lookaside_buffer(this, section_virtual_address);
+            return true;
+        }
+        this->split_block(page_descriptor);
+        return this->resolve_copy_on_write(virtual_address);
+    }
+    if (buddy_allocator::get().get_reference_count(page) == 1) {
+        this->map(page_virtual_address, type_t::user, page_physical_address, page_size);
+    } else {
+        auto *new_page = buddy_allocator::get().allocate<page_t>(0);
+        *new_page = *page;
+        this->map(page_virtual_address, type_t::user, new_page, page_size);
+        buddy_allocator::get().deallocate(page);
+    }
+    virtual_memory::flush_translation_lookaside_buffer(this, page_virtual_address);
+    return true;
+}
+
+auto page_table_t::is_section_empty(uintptr_t virtual_address) -> bool {
+    auto *block_descriptor = this->walk_to_level_2(virtual_address, mode_t::do_not_create);
+    return block_descriptor == nullptr || !block_descriptor->is_valid();
+}
+
+auto page_table_t::is_user_writable(uintptr_t virtual_address) -> bool {
+    auto *page_descriptor = this->walk(virtual_address, mode_t::do_not_create);
+    return page_descriptor != nullptr && page_descriptor->is_user_writable();
+}
+
+// A block that is still shared is copied page by page so that the other owners keep the whole block
+auto page_table_t::split_block(page_table_descriptor_t *block_descriptor) -> void {
+    auto block_physical_address = block_descriptor->get_output_address_upper_bits();
+    auto *block =
+        reinterpret_cast<page_t *>(kernel_address_space_constants::virtual_address_begin + block_physical_address);
+    auto is_shared = buddy_allocator::get().contains(block) && buddy_allocator::get().get_reference_count(block) > 1;
+    auto *new_page_table = buddy_allocator::get().allocate<page_table_t>(0);
+    for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
+        auto page_physical_address = block_physical_address + i * page_size;
+        if (is_shared) {
+            auto *new_page = buddy_allocator::get().allocate<page_t>(0);
+            *new_page = block[i];
+            page_physical_address = reinterpretable_t<void *>(new_page).to_integer() -
+                                    kernel_address_space_constants::virtual_address_begin;
+        }
+        new_page_table->set_descriptor_at_index(i, block_descriptor->get_page_descriptor(page_physical_address));
+    }
+    if (is_shared) {
+        buddy_allocator::get().deallocate(block);
+    } else if (buddy_allocator::get().contains(block)) {
+        buddy_allocator::get().split(block);
+    }
+    *block_descriptor = page_table_descriptor_t();
+    virtual_memory::flush_translation_lookaside_buffer(this);
+    *block_descriptor = page_table_descriptor_t(new_page_table);
 }
 
 auto page_table_t::walk(uintptr_t value, mode_t mode) -> page_table_descriptor_t * {
+    auto *level_2_page_table_descriptor_address = this->walk_to_level_2(value, mode);
+    if (level_2_page_table_descriptor_address == nullptr) {
+        return nullptr;
+    }
+    if (level_2_page_table_descriptor_address->is_block()) {
+        if (mode == mode_t::do_not_create) {
+            return level_2_page_table_descriptor_address;
+        }
+        if (mode == mode_t::create_el1_mapping) {
+            panic("page_table::walk");
+        }
+        this->split_block(level_2_page_table_descriptor_address);
+    }
+    if (!level_2_page_table_descriptor_address->is_valid()) {
+        switch (mode) {
+        case mode_t::create_el1_mapping: {
+            auto &new_page_table = virtual_memory::get().allocate_new_exception_level_1_page_table();
+            for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
+                new_page_table.set_descriptor_at_index(i, {});
+            }
+            *level_2_page_table_descriptor_address = page_table_descriptor_t(&new_page_table);
+            break;
+        }
+        case mode_t::create_el0_mapping: {
+            auto *new_page_table = buddy_allocator::get().allocate_zeroed<page_table_t>(0);
+            *level_2_page_table_descriptor_address = page_table_descriptor_t(new_page_table);
+            break;
+        }
+        case mode_t::do_not_create: {
+            return nullptr;
+        }
+        }
+    }
+
+    auto *level_3_page_table_address = level_2_page_table_descriptor_address->get_next_level_table_address();
+    auto level_3_page_table_index = get_level_3_page_table_index(value);
+    return &level_3_page_table_address->get_descriptor_at_index(level_3_page_table_index);
+}
+
+auto page_table_t::walk_to_level_2(uintptr_t value, mode_t mode) -> page_table_descriptor_t * {
     auto level_0_page_table_index = get_level_0_page_table_index(value);
     auto level_0_page_table_descriptor = this->get_descriptor_at_index(level_0_page_table_index);
     if (!level_0_page_table_descriptor.is_valid()) {
@@ -383,10 +741,7 @@ auto page_table_t::walk(uintptr_t value, mode_t mode) -> page_table_descriptor_t
             break;
         }
         case mode_t::create_el0_mapping: {
-            auto *new_page_table = buddy_allocator::get().allocate<page_table_t>(0);
-            for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
-                new_page_table->set_descriptor_at_index(i, {});
-            }
+            auto *new_page_table = buddy_allocator::get().allocate_zeroed<page_table_t>(0);
             level_0_page_table_descriptor = page_table_descriptor_t(new_page_table);
             this->set_descriptor_at_index(level_0_page_table_index, level_0_page_table_descriptor);
             break;
@@ -413,10 +768,7 @@ auto page_table_t::walk(uintptr_t value, mode_t mode) -> page_table_descriptor_t
             break;
         }
         case mode_t::create_el0_mapping: {
-            auto *new_page_table = buddy_allocator::get().allocate<page_table_t>(0);
-            for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
-                new_page_table->set_descriptor_at_index(i, {});
-            }
+            auto *new_page_table = buddy_allocator::get().allocate_zeroed<page_table_t>(0);
             level_1_page_table_descriptor = page_table_descriptor_t(new_page_table);
             level_1_page_table_address->set_descriptor_at_index(level_1_page_table_index,
                                                                 level_1_page_table_descriptor);
@@ -430,38 +782,26 @@ auto page_table_t::walk(uintptr_t value, mode_t mode) -> page_table_descriptor_t
 
     auto *level_2_page_table_address = level_1_page_table_descriptor.get_next_level_table_address();
     auto level_2_page_table_index = get_level_2_page_table_index(value);
-    auto level_2_page_table_descriptor = level_2_page_table_address->get_descriptor_at_index(level_2_page_table_index);
-    if (!level_2_page_table_descriptor.is_valid()) {
-        switch (mode) {
-        case mode_t::create_el1_mapping: {
-            auto &new_page_table = virtual_memory::get().allocate_new_exception_level_1_page_table();
-            for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
-                new_page_table.set_descriptor_at_index(i, {});
-            }
-            level_2_page_table_descriptor = page_table_descriptor_t(&new_page_table);
-            level_2_page_table_address->set_descriptor_at_index(level_2_page_table_index,
-                                                                level_2_page_table_descriptor);
-            break;
-        }
-        case mode_t::create_el0_mapping: {
-            auto *new_page_table = buddy_allocator::get().allocate<page_table_t>(0);
-            for (size_t i = 0; i < sizeof(page_table_t) / sizeof(page_table_descriptor_t); i++) {
-                new_page_table->set_descriptor_at_index(i, {});
-            }
-            level_2_page_table_descriptor = page_table_descriptor_t(new_page_table);
-            level_2_page_table_address->set_descriptor_at_index(level_2_page_table_index,
-                                                                level_2_page_table_descriptor);
-            break;
-        }
-        case mode_t::do_not_create: {
-            return nullptr;
-        }
-        }
-    }
+    return &level_2_page_table_address->get_descriptor_at_index(level_2_page_table_index);
+}
 
-    auto *level_3_page_table_address = level_2_page_table_descriptor.get_next_level_table_address();
-    auto level_3_page_table_index = get_level_3_page_table_index(value);
-    return &level_3_page_table_address->get_descriptor_at_index(level_3_page_table_index);
+page_table_walker_t::page_table_walker_t(page_table_t *level_0_page_table, page_table_t::mode_t mode)
+    : level_0_page_table(level_0_page_table), mode(mode) {}
+
+auto page_table_walker_t::walk(uintptr_t virtual_address) -> page_table_descriptor_t * {
+    auto section_virtual_address = virtual_address & ~(section_size - 1);
+    if (this->level_3_page_table != nullptr && this->section_virtual_address == section_virtual_address) {
+        return this->level_3_page_table->get_address_of_descriptor_at_index(
+            get_level_3_page_table_index(virtual_address));
+    }
+    auto *page_descriptor = this->level_0_page_table->walk(virtual_address, this->mode);
+    this->level_3_page_table = nullptr;
+    if (page_descriptor != nullptr && !page_descriptor->is_block()) {
+        this->level_3_page_table = reinterpret_cast<page_table_t *>(
+            reinterpretable_t<void *>(page_descriptor).to_integer() & ~(page_size - 1));
+        this->section_virtual_address = section_virtual_address;
+    }
+    return page_descriptor;
 }
 
 auto clear_level_3_page_table(page_table_t *level_3_page_table_address) -> void {
@@ -472,8 +812,11 @@ auto clear_level_3_page_table(page_table_t *level_3_page_table_address) -> void
             level_3_page_table_address->get_address_of_descriptor_at_index(level_3_page_table_index);
         if (level_3_page_table_descriptor_address->is_valid()) {
             auto page_physical_address = level_3_page_table_descriptor_address->get_output_address_upper_bits();
-            buddy_allocator::get().deallocate(reinterpret_cast<void *>(
-                kernel_address_space_constants::virtual_address_begin + page_physical_address));
+            auto *page = reinterpret_cast<void *>(kernel_address_space_constants::virtual_address_begin +
+                                                  page_physical_address);
+            if (buddy_allocator::get().contains(page)) {
+                buddy_allocator::get().deallocate(page);
+            }
         }
     }
 };
@@ -484,7 +827,14 @@ auto clear_level_2_page_table(page_table_t *level_2_page_table_address) -> void
          level_2_page_table_index++) {
         auto *level_2_page_table_descriptor_address =
             level_2_page_table_address->get_address_of_descriptor_at_index(level_2_page_table_index);
-        if (level_2_page_table_descriptor_address->is_valid()) {
+        if (level_2_page_table_descriptor_address->is_block()) {
+            auto block_physical_address = level_2_page_table_descriptor_address->get_output_address_upper_bits();
+            auto *block = reinterpret_cast<void *>(kernel_address_space_constants::virtual_address_begin +
+                                                   block_physical_address);
+            if (buddy_allocator::get().contains(block)) {
+                buddy_allocator::get().deallocate(block);
+            }
+        } else if (level_2_page_table_descriptor_address->is_valid()) {
             auto *level_3_page_table_address = level_2_page_table_descriptor_address->get_next_level_table_address();
             if (level_3_page_table_address != nullptr) {
                 clear_level_3_page_table(level_3_page_table_address);
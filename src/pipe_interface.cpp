@@ -5,43 +5,173 @@
 
 namespace process {
 
-auto pipe_t::read() -> byte_t {
+auto pipe_t::read(span_t<byte_t> data, bool blocking) -> size_t {
     lock.acquire();
     while (read_pointer == write_pointer) {
         if (this->writers_count < 1) {
             lock.release();
-            return byte_t{};
+            return 0;
+        }
+        if (!blocking) {
+            lock.release();
+            return static_cast<size_t>(synchronization::would_block);
         }
         thread_scheduler::get().sleep(this, lock);
     }
-    auto value = (*buffer)[read_pointer];
-    read_pointer = (read_pointer + 1) % memory::page_size;
+    size_t result = 0;
+    while (result < data.size() && read_pointer != write_pointer) {
+        auto offset = read_pointer % capacity;
+        auto number_of_bytes_to_copy = data.size() - result;
+        if (number_of_bytes_to_copy > write_pointer - read_pointer) {
+            number_of_bytes_to_copy = write_pointer - read_pointer;
+        }
+        if (number_of_bytes_to_copy > capacity - offset) {
+            number_of_bytes_to_copy = capacity - offset;
+        }
+        for (size_t i = 0; i < number_of_bytes_to_copy; i++) {
+            data[result + i] = buffer[offset + i];
+        }
+        result += number_of_bytes_to_copy;
+        read_pointer += number_of_bytes_to_copy;
+    }
+    lock.release();
+    thread_scheduler::get().wake(this);
+    return result;
+}
+
+auto pipe_t::write(span_t<byte_t> data, bool blocking) -> size_t {
+    lock.acquire();
+    size_t result = 0;
+    while (result < data.size()) {
+        if (this->readers_count < 1) {
+            break;
+        }
+        if (write_pointer - read_pointer == capacity) {
+            if (!blocking) {
+                if (result == 0) {
+                    result = static_cast<size_t>(synchronization::would_block);
+                }
+                break;
+            }
+            thread_scheduler::get().wake(this);
+            thread_scheduler::get().sleep(this, lock);
+            continue;
+        }
+        auto offset = write_pointer % capacity;
+        auto number_of_bytes_to_copy = data.size() - result;
+        if (number_of_bytes_to_copy > capacity - (write_pointer - read_pointer)) {
+            number_of_bytes_to_copy = capacity - (write_pointer - read_pointer);
+        }
+        if (number_of_bytes_to_copy > capacity - offset) {
+            number_of_bytes_to_copy = capacity - offset;
+        }
+        for (size_t i = 0; i < number_of_bytes_to_copy; i++) {
+            buffer[offset + i] = data[result + i];
+        }
+        result += number_of_bytes_to_copy;
+        write_pointer += number_of_bytes_to_copy;
+    }
     lock.release();
     thread_scheduler::get().wake(this);
-    return value;
+    return result;
+}
+
+auto pipe_t::peek(span_t<byte_t> data, bool blocking) -> size_t {
+    lock.acquire();
+    while (read_pointer == write_pointer) {
+        if (this->writers_count < 1) {
+            lock.release();
+            return 0;
+        }
+        if (!blocking) {
+            lock.release();
+            return static_cast<size_t>(synchronization::would_block);
+        }
+        thread_scheduler::get().sleep(this, lock);
+    }
+    size_t result = 0;
+    for (auto pointer = read_pointer; pointer != write_pointer && result < data.size(); pointer++) {
+        data[result] = buffer[pointer % capacity];
+        result += 1;
+    }
+    lock.release();
+    return result;
 }
 
-auto pipe_t::write(byte_t value) -> void {
+auto pipe_t::get_free_space(bool blocking) -> size_t {
     lock.acquire();
-    if ((write_pointer + 1) % memory::page_size == read_pointer) {
+    while (write_pointer - read_pointer == capacity) {
         if (this->readers_count < 1) {
             lock.release();
-            return;
+            return 0;
+        }
+        if (!blocking) {
+            lock.release();
+            return static_cast<size_t>(synchronization::would_block);
         }
         thread_scheduler::get().sleep(this, lock);
     }
-    (*buffer)[write_pointer] = value;
-    write_pointer = (write_pointer + 1) % memory::page_size;
+    auto result = this->readers_count < 1 ? 0 : capacity - (write_pointer - read_pointer);
+    lock.release();
+    return result;
+}
+
+auto pipe_t::resize(size_t new_capacity) -> size_t {
+    size_t order = 0;
+    while ((memory::page_size << order) < new_capacity && order < pipe_interface_constants::maximum_pipe_order) {
+        order += 1;
+    }
+    lock.acquire();
+    if (buffer == nullptr || write_pointer - read_pointer > (memory::page_size << order)) {
+        lock.release();
+        return 0;
+    }
+    auto new_buffer = memory::buddy_allocator::get().allocate(static_cast<int>(order));
+    auto number_of_buffered_bytes = write_pointer - read_pointer;
+    for (size_t i = 0; i < number_of_buffered_bytes; i++) {
+        new_buffer[i] = buffer[(read_pointer + i) % capacity];
+    }
+    memory::buddy_allocator::get().deallocate(buffer);
+    buffer = new_buffer.data();
+    capacity = new_buffer.size();
+    read_pointer = 0;
+    write_pointer = number_of_buffered_bytes;
+    lock.release();
     thread_scheduler::get().wake(this);
+    return capacity;
+}
+
+auto pipe_t::poll() -> synchronization::readiness_t {
+    lock.acquire();
+    synchronization::readiness_t readiness = {};
+    readiness.readable = read_pointer != write_pointer || this->writers_count < 1;
+    readiness.writable = write_pointer - read_pointer < capacity || this->readers_count < 1;
+    readiness.closed = this->writers_count < 1 || this->readers_count < 1;
+    readiness.condition = this;
     lock.release();
+    return readiness;
+}
+
+auto pipe_t::allocate_buffer() -> void {
+    auto new_buffer = memory::buddy_allocator::get().allocate(pipe_interface_constants::default_pipe_order);
+    this->buffer = new_buffer.data();
+    this->capacity = new_buffer.size();
+    this->read_pointer = 0;
+    this->write_pointer = 0;
+}
+
+auto pipe_t::deallocate_buffer() -> void {
+    memory::buddy_allocator::get().deallocate(this->buffer);
+    this->buffer = nullptr;
+    this->capacity = 0;
+    this->read_pointer = 0;
+    this->write_pointer = 0;
 }
 
 auto pipe_t::open_reader() -> void {
     lock.acquire();
     if (this->readers_count == 0 && this->writers_count == 0) {
-        this->buffer = memory::buddy_allocator::get().allocate<array_t<byte_t, memory::page_size>>(0);
-        this->read_pointer = 0;
-        this->write_pointer = 0;
+        this->allocate_buffer();
     }
     this->readers_count += 1;
     lock.release();
@@ -50,9 +180,7 @@ auto pipe_t::open_reader() -> void {
 auto pipe_t::open_writer() -> void {
     lock.acquire();
     if (this->readers_count == 0 && this->writers_count == 0) {
-        this->buffer = memory::buddy_allocator::get().allocate<array_t<byte_t, memory::page_size>>(0);
-        this->read_pointer = 0;
-        this->write_pointer = 0;
+        this->allocate_buffer();
     }
     this->writers_count += 1;
     lock.release();
@@ -62,9 +190,7 @@ auto pipe_t::close_reader() -> void {
     lock.acquire();
     this->readers_count -= 1;
     if (this->readers_count == 0 && this->writers_count == 0) {
-        memory::buddy_allocator::get().deallocate(this->buffer);
-        this->read_pointer = 0;
-        this->write_pointer = 0;
+        this->deallocate_buffer();
     }
     lock.release();
     thread_scheduler::get().wake(this);
@@ -74,9 +200,7 @@ auto pipe_t::close_writer() -> void {
     lock.acquire();
     this->writers_count -= 1;
     if (this->readers_count == 0 && this->writers_count == 0) {
-        memory::buddy_allocator::get().deallocate(this->buffer);
-        this->read_pointer = 0;
-        this->write_pointer = 0;
+        this->deallocate_buffer();
     }
     lock.release();
     thread_scheduler::get().wake(this);
@@ -102,13 +226,28 @@ auto pipe_interface::get() -> int {
     return -1;
 }
 
-auto pipe_interface::read(int pipe_index) -> byte_t {
-    auto value = this->pipes[pipe_index].read();
-    return value;
+auto pipe_interface::read(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t {
+    return this->pipes[pipe_index].read(data, blocking);
+}
+
+auto pipe_interface::write(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t {
+    return this->pipes[pipe_index].write(data, blocking);
+}
+
+auto pipe_interface::peek(int pipe_index, span_t<byte_t> data, bool blocking) -> size_t {
+    return this->pipes[pipe_index].peek(data, blocking);
+}
+
+auto pipe_interface::get_free_space(int pipe_index, bool blocking) -> size_t {
+    return this->pipes[pipe_index].get_free_space(blocking);
+}
+
+auto pipe_interface::resize(int pipe_index, size_t new_capacity) -> size_t {
+    return this->pipes[pipe_index].resize(new_capacity);
 }
 
-auto pipe_interface::write(int pipe_index, byte_t value) -> void {
-    this->pipes[pipe_index].write(value);
+auto pipe_interface::poll(int pipe_index) -> synchronization::readiness_t {
+    return this->pipes[pipe_index].poll();
 }
 
 auto pipe_interface::open_reader(int pipe_index) -> void {
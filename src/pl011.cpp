@@ -110,6 +110,19 @@ auto pl011::is_initialized() const -> bool {
     return this->initialized;
 }
 
+auto pl011::poll() -> synchronization::readiness_t {
+    synchronization::readiness_t readiness = {};
+    receiver_ring_buffer_lock.acquire();
+    readiness.readable = receiver_ring_buffer_read_index != receiver_ring_buffer_write_index;
+    receiver_ring_buffer_lock.release();
+    transmitter_ring_buffer_lock.acquire();
+    readiness.writable =
+        (transmitter_ring_buffer_write_index + 1) % pl011_buffer_size != transmitter_ring_buffer_read_index;
+    transmitter_ring_buffer_lock.release();
+    readiness.condition = this;
+    return readiness;
+}
+
 void pl011::interrupt() {
     flush_receiver_buffer();
     flush_transmitter_buffer();
@@ -0,0 +1,255 @@
+#include "../include/ring_interface.hpp"
+#include "../include/buddy_allocator.hpp"
+#include "../include/descriptor_interface.hpp"
+#include "../include/process.hpp"
+#include "../include/thread_scheduler.hpp"
+#include "../include/timer.hpp"
+#include "../include/user_memory.hpp"
+
+namespace file {
+
+auto ring_interface::create(uint64_t process_id, memory::page_table_t *level_0_page_table, uint32_t flags) -> int {
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_rings; i++) {
+        auto &ring = this->rings[i];
+        ring.lock.acquire();
+        this->lock.acquire();
+        if (ring.reference_count == 0 && ring.shared_ring == nullptr) {
+            ring.reference_count = 1;
+            this->lock.release();
+            auto shared_ring_span =
+                memory::buddy_allocator::get().allocate_zeroed(descriptor_interface_constants::ring_order);
+            ring.process_id = process_id;
+            ring.level_0_page_table = level_0_page_table;
+            ring.shared_ring = reinterpretable_t<span_t<byte_t>>(shared_ring_span).to<shared_ring_t>();
+            auto &header = ring.shared_ring->header;
+            header.set_number_of_entries_field(descriptor_interface_constants::number_of_ring_entries);
+            header.set_flags_field(flags);
+            ring.flags = flags;
+            ring.number_of_pending_entries = 0;
+            level_0_page_table->map(this->get_user_address(i), memory::page_table_t::type_t::user, ring.shared_ring,
+                                    shared_ring_span.size());
+            ring.lock.release();
+            process::thread_scheduler::get().wake(this);
+            return i;
+        }
+        this->lock.release();
+        ring.lock.release();
+    }
+    return -1;
+}
+
+auto ring_interface::get_user_address(int ring_index) -> uintptr_t {
+    return memory::user_address_space_constants::ring_begin +
+           ring_index * (memory::page_size << descriptor_interface_constants::ring_order);
+}
+
+auto ring_interface::reference(int ring_index) -> void {
+    this->lock.acquire();
+    this->rings[ring_index].reference_count += 1;
+    this->lock.release();
+}
+
+auto ring_interface::dereference(int ring_index) -> void {
+    auto &ring = this->rings[ring_index];
+    this->lock.acquire();
+    ring.reference_count -= 1;
+    auto reference_count = ring.reference_count;
+    this->lock.release();
+    if (reference_count > 0) {
+        return;
+    }
+    ring.lock.acquire();
+    if (ring.reference_count == 0 && ring.shared_ring != nullptr) {
+        ring.level_0_page_table->unmap(this->get_user_address(ring_index),
+                                       memory::page_size << descriptor_interface_constants::ring_order);
+        memory::buddy_allocator::get().deallocate(ring.shared_ring);
+        ring.process_id = 0;
+        ring.level_0_page_table = nullptr;
+        ring.shared_ring = nullptr;
+        ring.flags = 0;
+        ring.number_of_pending_entries = 0;
+    }
+    ring.lock.release();
+    process::thread_scheduler::get().wake(&ring);
+}
+
+auto ring_interface::enter(int ring_index, size_t minimum_number_of_completions) -> size_t {
+    auto &ring = this->rings[ring_index];
+    process::thread_scheduler::get().wake(this);
+    void *condition = &ring;
+    while (true) {
+        ring.lock.acquire();
+        if (ring.shared_ring == nullptr) {
+            ring.lock.release();
+            return 0;
+        }
+        auto &header = ring.shared_ring->header;
+        size_t number_of_completions = header.get_completion_tail_field() - header.get_completion_head_field();
+        ring.lock.release();
+        if (number_of_completions >= minimum_number_of_completions) {
+            process::thread_scheduler::get().register_wait_conditions(span_t<void *>{});
+            return number_of_completions;
+        }
+        process::thread_scheduler::get().register_wait_conditions(span_t(&condition, 1));
+        ring.lock.acquire();
+        number_of_completions = header.get_completion_tail_field() - header.get_completion_head_field();
+        ring.lock.release();
+        if (number_of_completions < minimum_number_of_completions) {
+            process::thread_scheduler::get().sleep_on_wait_conditions();
+        }
+    }
+}
+
+auto ring_interface::handle_operations() -> void {
+    array_t<void *, process::thread_scheduler_constants::maximum_number_of_wait_conditions> conditions{};
+    array_t<void *, process::thread_scheduler_constants::maximum_number_of_wait_conditions> unused_conditions{};
+    auto conditions_span =
+        span_t(&conditions[0], process::thread_scheduler_constants::maximum_number_of_wait_conditions);
+    auto unused_conditions_span =
+        span_t(&unused_conditions[0], process::thread_scheduler_constants::maximum_number_of_wait_conditions);
+    while (true) {
+        size_t number_of_conditions = 0;
+        if (this->process_rings(conditions_span, &number_of_conditions)) {
+            continue;
+        }
+        process::thread_scheduler::get().register_wait_conditions(span_t(&conditions[0], number_of_conditions));
+        size_t number_of_unused_conditions = 0;
+        if (this->process_rings(unused_conditions_span, &number_of_unused_conditions)) {
+            process::thread_scheduler::get().register_wait_conditions(span_t<void *>{});
+            continue;
+        }
+        process::thread_scheduler::get().sleep_on_wait_conditions();
+    }
+}
+
+auto add_condition(span_t<void *> conditions, size_t *number_of_conditions, void *condition) -> bool {
+    if (condition == nullptr) {
+        return true;
+    }
+    for (size_t i = 0; i < *number_of_conditions; i++) {
+        if (conditions[i] == condition) {
+            return true;
+        }
+    }
+    if (*number_of_conditions == conditions.size()) {
+        return false;
+    }
+    conditions[*number_of_conditions] = condition;
+    *number_of_conditions += 1;
+    return true;
+}
+
+auto ring_interface::process_rings(span_t<void *> conditions, size_t *number_of_conditions) -> bool {
+    conditions[0] = this;
+    *number_of_conditions = 1;
+    auto ring_conditions = span_t(&conditions[0], conditions.size() - 1);
+    auto should_poll = false;
+    auto progressed = false;
+    for (auto &ring : this->rings) {
+        progressed = this->process_ring(ring, ring_conditions, number_of_conditions, &should_poll) || progressed;
+    }
+    if (should_poll) {
+        conditions[*number_of_conditions] = &device::timer::get();
+        *number_of_conditions += 1;
+    }
+    return progressed;
+}
+
+auto ring_interface::process_ring(ring_t &ring, span_t<void *> conditions, size_t *number_of_conditions,
+                                  bool *should_poll) -> bool {
+    ring.lock.acquire();
+    if (ring.shared_ring == nullptr) {
+        ring.lock.release();
+        return false;
+    }
+    if ((ring.flags & descriptor_interface_constants::polling_ring) != 0) {
+        *should_poll = true;
+    }
+    auto progressed = false;
+    auto &header = ring.shared_ring->header;
+    auto submission_head = header.get_submission_head_field();
+    auto submission_tail = header.get_submission_tail_field();
+    size_t number_of_occupied_completions = header.get_completion_tail_field() - header.get_completion_head_field();
+    while (submission_head != submission_tail &&
+           ring.number_of_pending_entries + number_of_occupied_completions <
+               descriptor_interface_constants::number_of_ring_entries) {
+        auto submission_index = submission_head % descriptor_interface_constants::number_of_ring_entries;
+        ring.pending_entries[ring.number_of_pending_entries] = ring.shared_ring->submission_entries[submission_index];
+        ring.number_of_pending_entries += 1;
+        submission_head += 1;
+        progressed = true;
+    }
+    header.set_submission_head_field(submission_head);
+
+    size_t entry_index = 0;
+    while (entry_index < ring.number_of_pending_entries) {
+        auto entry = ring.pending_entries[entry_index];
+        void *condition = nullptr;
+        auto result = this->execute(ring, entry, &condition);
+        if (result == synchronization::would_block) {
+            if (!add_condition(conditions, number_of_conditions, condition)) {
+                *should_poll = true;
+            }
+            entry_index += 1;
+            continue;
+        }
+        this->complete(ring, entry.get_user_data_field(), result);
+        for (size_t i = entry_index; i + 1 < ring.number_of_pending_entries; i++) {
+            ring.pending_entries[i] = ring.pending_entries[i + 1];
+        }
+        ring.number_of_pending_entries -= 1;
+        progressed = true;
+    }
+    ring.lock.release();
+    return progressed;
+}
+
+auto ring_interface::execute(ring_t &ring, submission_entry_t entry, void **condition_address) -> int64_t {
+    auto operation = static_cast<ring_operation_t>(entry.get_operation_field());
+    memory::user_buffer_t buffer{};
+    process::process *owner = nullptr;
+    auto is_written_by_kernel = operation == ring_operation_t::read || operation == ring_operation_t::receive;
+    // The submitting process keeps running on other cores, so its address space stays locked from translating the
+    // buffer until the result is copied back; pages are faulted in beforehand because the lock excludes faults
+    if (is_written_by_kernel || operation == ring_operation_t::write || operation == ring_operation_t::send) {
+        if (!memory::fault_in_user_range(ring.level_0_page_table, entry.get_address_field(), entry.get_size_field(),
+                                         is_written_by_kernel)) {
+            return -1;
+        }
+        owner = process::thread_scheduler::get().acquire_address_space(ring.level_0_page_table);
+        if (owner == nullptr) {
+            return -1;
+        }
+        buffer = memory::acquire_user_buffer(ring.level_0_page_table, entry.get_address_field(), entry.get_size_field(),
+                                             is_written_by_kernel, false);
+        if (buffer.kernel_span.data() == nullptr && entry.get_size_field() != 0) {
+            owner->address_space_lock.release();
+            return -1;
+        }
+    }
+    auto result = descriptor_interface::get().execute_ring_entry(ring.process_id, operation,
+                                                                 entry.get_file_descriptor_field(), buffer.kernel_span,
+                                                                 entry.get_offset_field(), condition_address);
+    auto number_of_bytes_written = is_written_by_kernel && result > 0 ? static_cast<size_t>(result) : 0;
+    auto success = memory::release_user_buffer(ring.level_0_page_table, buffer, number_of_bytes_written, false);
+    if (owner != nullptr) {
+        owner->address_space_lock.release();
+    }
+    if (!success) {
+        return -1;
+    }
+    return result;
+}
+
+auto ring_interface::complete(ring_t &ring, uint64_t user_data, int64_t result) -> void {
+    auto &header = ring.shared_ring->header;
+    auto completion_tail = header.get_completion_tail_field();
+    auto &completion_entry =
+        ring.shared_ring->completion_entries[completion_tail % descriptor_interface_constants::number_of_ring_entries];
+    completion_entry.set_user_data_field(user_data);
+    completion_entry.set_result_field(result);
+    header.set_completion_tail_field(completion_tail + 1);
+    process::thread_scheduler::get().wake(&ring);
+}
+
+} // namespace file
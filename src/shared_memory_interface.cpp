@@ -0,0 +1,104 @@
+#include "../include/shared_memory_interface.hpp"
+
+namespace file {
+
+auto shared_memory_interface::create(size_t size) -> int {
+    auto number_of_pages = (size + memory::page_size - 1) / memory::page_size;
+    if (number_of_pages == 0 ||
+        number_of_pages > descriptor_interface_constants::maximum_number_of_shared_memory_pages ||
+        memory::buddy_allocator::get().get_number_of_free_pages() < number_of_pages) {
+        return -1;
+    }
+    this->lock.acquire();
+    int shared_memory_index = -1;
+    for (int i = 0; i < descriptor_interface_constants::maximum_number_of_shared_memory_objects; i++) {
+        if (this->shared_memory_objects[i].reference_count == 0) {
+            this->shared_memory_objects[i].reference_count = 1;
+            shared_memory_index = i;
+            break;
+        }
+    }
+    this->lock.release();
+    if (shared_memory_index == -1) {
+        return -1;
+    }
+    auto &shared_memory = this->shared_memory_objects[shared_memory_index];
+    for (size_t i = 0; i < number_of_pages; i++) {
+        auto *page = memory::buddy_allocator::get().allocate_zeroed<memory::page_t>(0);
+        shared_memory.pages[i] = page;
+    }
+    shared_memory.number_of_pages = number_of_pages;
+    return shared_memory_index;
+}
+
+auto shared_memory_interface::reference(int shared_memory_index) -> void {
+    this->lock.acquire();
+    this->shared_memory_objects[shared_memory_index].reference_count += 1;
+    this->lock.release();
+}
+
+auto shared_memory_interface::dereference(int shared_memory_index) -> void {
+    auto &shared_memory = this->shared_memory_objects[shared_memory_index];
+    this->lock.acquire();
+    if (shared_memory.reference_count > 1) {
+        shared_memory.reference_count -= 1;
+        this->lock.release();
+        return;
+    }
+    this->lock.release();
+    for (size_t i = 0; i < shared_memory.number_of_pages; i++) {
+        memory::buddy_allocator::get().deallocate(shared_memory.pages[i]);
+        shared_memory.pages[i] = nullptr;
+    }
+    shared_memory.number_of_pages = 0;
+    this->lock.acquire();
+    shared_memory.reference_count = 0;
+    this->lock.release();
+}
+
+auto shared_memory_interface::get_size(int shared_memory_index) -> size_t {
+    return this->shared_memory_objects[shared_memory_index].number_of_pages * memory::page_size;
+}
+
+auto shared_memory_interface::map(int shared_memory_index, memory::page_table_t *level_0_page_table,
+                                  uintptr_t virtual_address, memory::page_table_t::type_t type,
+                                  size_t first_page_index, size_t number_of_pages) -> void {
+    auto &shared_memory = this->shared_memory_objects[shared_memory_index];
+    if (first_page_index >= shared_memory.number_of_pages) {
+        return;
+    }
+    if (number_of_pages > shared_memory.number_of_pages - first_page_index) {
+        number_of_pages = shared_memory.number_of_pages - first_page_index;
+    }
+    memory::page_table_walker_t walker(level_0_page_table, memory::page_table_t::mode_t::do_not_create);
+    size_t i = 0;
+    while (i < number_of_pages) {
+        auto *page_descriptor = walker.walk(virtual_address + i * memory::page_size);
+        if (page_descriptor != nullptr && page_descriptor->is_valid()) {
+            i += 1;
+            continue;
+        }
+        auto first_unmapped_page_index = i;
+        while (i < number_of_pages) {
+            auto page_virtual_address = virtual_address + i * memory::page_size;
+            page_descriptor = walker.walk(page_virtual_address);
+            if (page_descriptor != nullptr && page_descriptor->is_valid()) {
+                break;
+            }
+            size_t number_of_unmapped_pages = 1;
+            if (page_descriptor == nullptr) {
+                number_of_unmapped_pages =
+                    (memory::section_size - page_virtual_address % memory::section_size) / memory::page_size;
+            }
+            for (size_t j = 0; j < number_of_unmapped_pages && i < number_of_pages; j++) {
+                memory::buddy_allocator::get().reference(shared_memory.pages[first_page_index + i]);
+                i += 1;
+            }
+        }
+        level_0_page_table->map(virtual_address + first_unmapped_page_index * memory::page_size, type,
+                                span_t(&shared_memory.pages[first_page_index + first_unmapped_page_index],
+                                       i - first_unmapped_page_index));
+    }
+}
+
+} // namespace file
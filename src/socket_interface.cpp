@@ -12,8 +12,10 @@ auto socket_interface::handle_open_call(socket_type_t socket_type) -> int {
         socket.lock.acquire();
         if (socket.type == socket_type_t::unused) {
             socket.type = socket_type;
+            socket.reference_count = 1;
             socket.source_port_number = {};
             socket.control_block_index = SIZE_MAX;
+            socket.listening = false;
             socket.lock.release();
             return i;
         }
@@ -25,6 +27,11 @@ auto socket_interface::handle_open_call(socket_type_t socket_type) -> int {
 auto socket_interface::handle_close_call(int socket_index) -> bool {
     auto &socket = this->sockets[socket_index];
     socket.lock.acquire();
+    if (socket.type != socket_type_t::unused && socket.reference_count > 1) {
+        socket.reference_count -= 1;
+        socket.lock.release();
+        return true;
+    }
     request_t request = {};
     request.status = request_status_t::incomplete;
     request.type = request_type_t::close;
@@ -55,12 +62,23 @@ auto socket_interface::handle_close_call(int socket_index) -> bool {
     auto status = request.status;
     request.lock.release();
     socket.type = socket_type_t::unused;
+    socket.reference_count = 0;
     socket.source_port_number = {};
     socket.control_block_index = SIZE_MAX;
+    socket.listening = false;
     socket.lock.release();
     return status == request_status_t::completed;
 }
 
+auto socket_interface::handle_reference_call(int socket_index) -> void {
+    auto &socket = this->sockets[socket_index];
+    socket.lock.acquire();
+    if (socket.type != socket_type_t::unused) {
+        socket.reference_count += 1;
+    }
+    socket.lock.release();
+}
+
 auto socket_interface::handle_bind_call(int socket_index, port_number_t source_port_number) -> bool {
     auto &socket = this->sockets[socket_index];
     socket.lock.acquire();
@@ -188,12 +206,13 @@ auto socket_interface::handle_listen_call(int socket_index) -> bool {
     }
     socket.control_block_index = request.control_block_index;
     auto status = request.status;
+    socket.listening = status == request_status_t::completed;
     request.lock.release();
     socket.lock.release();
     return status == request_status_t::completed;
 }
 
-auto socket_interface::handle_accept_call(int socket_index) -> int {
+auto socket_interface::handle_accept_call(int socket_index, bool blocking) -> int {
     auto &socket = this->sockets[socket_index];
     socket.lock.acquire();
     if (socket.type != socket_type_t::tcp) {
@@ -204,6 +223,10 @@ auto socket_interface::handle_accept_call(int socket_index) -> int {
         socket.lock.release();
         return -1;
     }
+    if (!blocking && transmission_control_protocol_t::is_pending(socket.control_block_index)) {
+        socket.lock.release();
+        return static_cast<int>(synchronization::would_block);
+    }
 
     auto is_established = transmission_control_protocol_t::sleep_until_established(socket.control_block_index);
 
@@ -221,8 +244,10 @@ auto socket_interface::handle_accept_call(int socket_index) -> int {
         new_socket.lock.acquire();
         if (new_socket.type == socket_type_t::unused) {
             new_socket.type = socket_type_t::tcp;
+            new_socket.reference_count = 1;
             new_socket.source_port_number = socket.source_port_number;
             new_socket.control_block_index = socket.control_block_index;
+            new_socket.listening = false;
             new_socket_index = i;
             new_socket.lock.release();
             break;
@@ -266,7 +291,7 @@ auto socket_interface::handle_accept_call(int socket_index) -> int {
 
 auto socket_interface::handle_receive_call(int socket_index, span_t<byte_t> buffer,
                                            internet_protocol_address_t *internet_protocol_address_address,
-                                           port_number_t *port_number_address) -> size_t {
+                                           port_number_t *port_number_address, bool blocking) -> size_t {
     auto &socket = this->sockets[socket_index];
     socket.lock.acquire();
     if (socket.source_port_number == 0) {
@@ -286,6 +311,7 @@ auto socket_interface::handle_receive_call(int socket_index, span_t<byte_t> buff
     request.status = request_status_t::incomplete;
     request.type = request_type_t::receive;
     request.active = false;
+    request.blocking = blocking;
     request.buffer = buffer;
     request.number_of_bytes_to_transfer = buffer.size();
     request.number_of_bytes_transferred = 0;
@@ -320,12 +346,15 @@ auto socket_interface::handle_receive_call(int socket_index, span_t<byte_t> buff
     if (status == request_status_t::completed) {
         return number_of_bytes_transferred;
     }
+    if (status == request_status_t::would_block) {
+        return static_cast<size_t>(synchronization::would_block);
+    }
     return 0;
 }
 
 auto socket_interface::handle_transmit_call(int socket_index, span_t<byte_t> buffer,
                                             internet_protocol_address_t internet_protocol_address,
-                                            port_number_t port_number) -> size_t {
+                                            port_number_t port_number, bool blocking) -> size_t {
     auto &socket = this->sockets[socket_index];
     socket.lock.acquire();
     if (socket.source_port_number == 0) {
@@ -348,6 +377,7 @@ auto socket_interface::handle_transmit_call(int socket_index, span_t<byte_t> buf
     request.status = request_status_t::incomplete;
     request.type = request_type_t::transmit;
     request.active = false;
+    request.blocking = blocking;
     request.buffer = buffer;
     request.number_of_bytes_to_transfer = buffer.size();
     request.number_of_bytes_transferred = 0;
@@ -382,9 +412,36 @@ auto socket_interface::handle_transmit_call(int socket_index, span_t<byte_t> buf
     if (status == request_status_t::completed) {
         return number_of_bytes_transferred;
     }
+    if (status == request_status_t::would_block) {
+        return static_cast<size_t>(synchronization::would_block);
+    }
     return 0;
 }
 
+auto socket_interface::handle_poll_call(int socket_index) -> synchronization::readiness_t {
+    auto &socket = this->sockets[socket_index];
+    socket.lock.acquire();
+    synchronization::readiness_t readiness = {};
+    if (socket.control_block_index == SIZE_MAX) {
+        readiness.writable = socket.type == socket_type_t::udp;
+        socket.lock.release();
+        return readiness;
+    }
+    switch (socket.type) {
+    case socket_type_t::unused:
+        readiness.closed = true;
+        break;
+    case socket_type_t::tcp:
+        readiness = transmission_control_protocol_t::poll(socket.control_block_index, socket.listening);
+        break;
+    case socket_type_t::udp:
+        readiness = user_datagram_protocol_t::poll(socket.control_block_index);
+        break;
+    }
+    socket.lock.release();
+    return readiness;
+}
+
 auto socket_interface::handle_data_egress() -> void {
     while (true) {
         this->transmit_lock.acquire();
@@ -18,10 +18,7 @@ namespace process {
 using memory::page_table_t;
 
 void deallocate_address_space(memory::page_table_t *level_0_page_table) {
-    memory::buddy_allocator::get().deallocate(
-        reinterpretable_t<uintptr_t>(level_0_page_table, memory::user_address_space_constants::stack_begin).to<void>());
-    level_0_page_table->unmap(memory::user_address_space_constants::stack_begin,
-                              memory::user_address_space_constants::stack_size);
+    memory::virtual_memory::get().release_address_space(level_0_page_table);
     level_0_page_table->clear();
     memory::buddy_allocator::get().deallocate(level_0_page_table);
 }
@@ -41,6 +38,14 @@ void process_init() {
         networking::socket_interface::get().handle_data_egress();
     }
 
+    if (thread_scheduler::get().get_current_process_id() == 5) {
+        file::descriptor_interface::get().handle_ring_operations();
+    }
+
+    if (thread_scheduler::get().get_current_process_id() == 6) {
+        memory::buddy_allocator::get().handle_page_zeroing();
+    }
+
     if (thread_scheduler::get().get_current_process_id() == 4) {
         synchronization::spin_lock lock;
         uint64_t previous_time = 0;
@@ -61,32 +66,15 @@ void process_init() {
 }
 
 auto create_init_address_space(void (*image_address)(), size_t image_size) -> memory::page_table_t * {
-    auto *level_0_page_table = memory::buddy_allocator::get().allocate<memory::page_table_t>(0);
-    for (size_t i = 0; i < sizeof(memory::page_table_t) / sizeof(memory::page_table_descriptor_t); i++) {
-        level_0_page_table->set_descriptor_at_index(i, {});
-    }
+    auto *level_0_page_table = memory::buddy_allocator::get().allocate_zeroed<memory::page_table_t>(0);
     level_0_page_table->map(memory::user_address_space_constants::image_begin, memory::page_table_t::type_t::user,
                             image_address, image_size);
-    auto *new_stack_pages =
-        memory::buddy_allocator::get().allocate<void>(memory::user_address_space_constants::stack_size_order);
-    level_0_page_table->map(memory::user_address_space_constants::stack_begin, memory::page_table_t::type_t::user,
-                            new_stack_pages, memory::user_address_space_constants::stack_size);
     return level_0_page_table;
 }
 
 auto create_init_process(void (*image_address)(), size_t image_size) -> process {
-    auto *section_detail_page =
-        memory::buddy_allocator::get()
-            .allocate<array_t<section_detail_t, memory::page_size / sizeof(section_detail_t)>>(0);
-    for (size_t i = 0; i < memory::page_size / sizeof(section_detail_t); i++) {
-        (*section_detail_page)[i] = section_detail_t();
-    }
     auto init_text_number_of_pages =
         image_size % memory::page_size == 0 ? image_size / memory::page_size : image_size / memory::page_size + 1;
-    (*section_detail_page)[0] =
-        section_detail_t{memory::user_address_space_constants::image_begin, init_text_number_of_pages};
-    (*section_detail_page)[1] = section_detail_t{memory::user_address_space_constants::stack_begin,
-                                                 1 << memory::user_address_space_constants::stack_size_order};
 
     auto *kernel_stack_begin = memory::buddy_allocator::get().allocate<kernel_stack_t>(
         memory::kernel_address_space_constants::stack_size_order);
@@ -102,12 +90,20 @@ auto create_init_process(void (*image_address)(), size_t image_size) -> process
     new_process.status = process_status::runnable;
     new_process.parent_id = -1;
     new_process.level_0_page_table = create_init_address_space(image_address, image_size);
-    new_process.section_details = section_detail_page;
+    new_process.regions[0].type = region_type_t::anonymous;
+    new_process.regions[0].virtual_address = memory::user_address_space_constants::image_begin;
+    new_process.regions[0].number_of_pages = init_text_number_of_pages;
+    new_process.regions[1].type = region_type_t::anonymous;
+    new_process.regions[1].virtual_address = memory::user_address_space_constants::stack_begin;
+    new_process.regions[1].number_of_pages = 1 << memory::user_address_space_constants::stack_size_order;
+    new_process.regions[2].type = region_type_t::anonymous;
+    new_process.regions[2].virtual_address =
+        memory::user_address_space_constants::image_begin + init_text_number_of_pages * memory::page_size;
     new_process.kernel_stack_begin = kernel_stack_begin;
     new_process.kernel_mode_state = initial_context;
     new_process.user_mode_state = exception_frame_address;
-    new_process.text_size =
-        image_size % memory::page_size == 0 ? image_size / memory::page_size : image_size / memory::page_size + 1;
+    new_process.text_size = init_text_number_of_pages;
+    new_process.heap_begin = new_process.regions[2].virtual_address;
     new_process.heap_size = 0;
     new_process.stack_size = memory::user_address_space_constants::stack_size / memory::page_size;
     return new_process;
@@ -136,6 +132,12 @@ auto thread_scheduler::initialize() -> void {
 
         thread_scheduler::get().processes[4] = create_init_process(test, memory::page_size);
         file::descriptor_interface::get().initialize_file_descriptors(4);
+
+        thread_scheduler::get().processes[5] = create_init_process(test, memory::page_size);
+        file::descriptor_interface::get().initialize_file_descriptors(5);
+
+        thread_scheduler::get().processes[6] = create_init_process(test, memory::page_size);
+        file::descriptor_interface::get().initialize_file_descriptors(6);
     }
 }
 
@@ -144,15 +146,16 @@ extern "C" void process_thread_to_scheduler_thread(context *process_thread_conte
 
 void thread_scheduler::schedule() {
     while (true) {
+        auto is_idle = true;
         for (int i = 0; i < thread_scheduler_constants::maximum_number_of_processes; i++) {
             auto &process = processes[i];
             process.lock.acquire();
             if (process.status == process_status::runnable) {
                 process.status = process_status::running;
+                is_idle = false;
 
                 current_process_indices[architecture::get_core_number()] = i;
-                memory::virtual_memory::set_translation_table_base_0_register(&*process.level_0_page_table);
-                memory::virtual_memory::flush_translation_lookaside_buffer();
+                memory::virtual_memory::get().switch_address_space(process.level_0_page_table);
 
                 scheduler_thread_to_process_thread(&scheduler_thread_contexts[architecture::get_core_number()],
                                                    &process.kernel_mode_state);
@@ -162,6 +165,10 @@ void thread_scheduler::schedule() {
             device::pl011::get().flush_transmitter_buffer();
             thread_scheduler::get().wake(&device::pl011::get());
         }
+        // page zeroing only runs on a pass that found nothing else to run
+        if (is_idle) {
+            thread_scheduler::get().wake(&memory::buddy_allocator::get());
+        }
     }
 }
 
@@ -188,6 +195,15 @@ void thread_scheduler::sleep(void *condition, synchronization::spin_lock &lock)
     lock.acquire();
 }
 
+auto is_waiting_on(process &process, void *condition) -> bool {
+    for (size_t i = 0; i < process.number_of_wait_conditions; i++) {
+        if (process.wait_conditions[i] == condition) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void thread_scheduler::wake(void *condition) {
     for (int i = 0; i < thread_scheduler_constants::maximum_number_of_processes; i++) {
         auto &process = processes[i];
@@ -196,9 +212,45 @@ void thread_scheduler::wake(void *condition) {
             if (process.status == process_status::sleeping && process.condition == condition) {
                 process.status = process_status::runnable;
             }
+            if (is_waiting_on(process, condition)) {
+                process.woken = true;
+                if (process.status == process_status::sleeping) {
+                    process.status = process_status::runnable;
+                }
+            }
             process.lock.release();
+        } else if (is_waiting_on(process, condition)) {
+            process.woken = true;
+        }
+    }
+}
+
+void thread_scheduler::register_wait_conditions(span_t<void *> conditions) {
+    auto &current_process = get_current_process();
+    current_process.lock.acquire();
+    current_process.number_of_wait_conditions = 0;
+    for (auto *condition : conditions) {
+        if (condition != nullptr &&
+            current_process.number_of_wait_conditions < thread_scheduler_constants::maximum_number_of_wait_conditions) {
+            current_process.wait_conditions[current_process.number_of_wait_conditions] = condition;
+            current_process.number_of_wait_conditions += 1;
         }
     }
+    current_process.woken = false;
+    current_process.lock.release();
+}
+
+void thread_scheduler::sleep_on_wait_conditions() {
+    auto &current_process = get_current_process();
+    current_process.lock.acquire();
+    if (!current_process.woken && current_process.number_of_wait_conditions > 0) {
+        current_process.status = process_status::sleeping;
+        process_thread_to_scheduler_thread(&current_process.kernel_mode_state,
+                                           &scheduler_thread_contexts[architecture::get_core_number()]);
+    }
+    current_process.number_of_wait_conditions = 0;
+    current_process.woken = false;
+    current_process.lock.release();
 }
 
 auto thread_scheduler::get_current_process() -> process & {
@@ -209,19 +261,221 @@ auto thread_scheduler::get_current_process_id() -> int {
     return current_process_indices[architecture::get_core_number()];
 }
 
-auto thread_scheduler::fork() -> int {
-    int new_process_id = -1;
+auto find_region(region_list_t &regions, uintptr_t virtual_address) -> region_t * {
+    for (auto &region : regions) {
+        if (region.type != region_type_t::unused && virtual_address >= region.virtual_address &&
+            virtual_address < region.virtual_address + region.number_of_pages * memory::page_size) {
+            return &region;
+        }
+    }
+    return nullptr;
+}
+
+auto get_mapped_page_index(region_t &region, uintptr_t virtual_address) -> size_t {
+    return (region.file_offset + virtual_address - region.file_virtual_address) / memory::page_size;
+}
+
+auto reference_regions(region_list_t &regions) -> void {
+    for (auto &region : regions) {
+        if (region.type == region_type_t::file || region.type == region_type_t::mapped_file) {
+            file::descriptor_interface::get().reference_inode(region.index_of_inode_on_disk);
+        }
+        if (region.type == region_type_t::shared_memory) {
+            file::descriptor_interface::get().reference_shared_memory(region.shared_memory_index);
+        }
+    }
+}
+
+auto release_regions(region_list_t &regions) -> void {
+    for (auto &region : regions) {
+        if (region.type == region_type_t::mapped_file) {
+            file::descriptor_interface::get().synchronize_mapped_pages(
+                region.index_of_inode_on_disk, get_mapped_page_index(region, region.virtual_address),
+                region.number_of_pages);
+        }
+        if (region.type == region_type_t::file || region.type == region_type_t::mapped_file) {
+            file::descriptor_interface::get().release_inode(region.index_of_inode_on_disk);
+        }
+        if (region.type == region_type_t::shared_memory) {
+            file::descriptor_interface::get().release_shared_memory(region.shared_memory_index);
+        }
+        region = region_t();
+    }
+}
+
+auto thread_scheduler::find_address_space_owner(memory::page_table_t *level_0_page_table) -> process * {
+    if (get_current_process().level_0_page_table == level_0_page_table) {
+        return &get_current_process();
+    }
+    for (auto &process : processes) {
+        if (process.status != process_status::unused && process.level_0_page_table == level_0_page_table) {
+            return &process;
+        }
+    }
+    return nullptr;
+}
+
+auto thread_scheduler::resolve_page_fault(memory::page_table_t *level_0_page_table, uintptr_t virtual_address)
+    -> bool {
+    auto *owner = this->find_address_space_owner(level_0_page_table);
+    if (owner == nullptr) {
+        return false;
+    }
+    owner->address_space_lock.acquire();
+    auto result = this->resolve_page_fault(*owner, level_0_page_table, virtual_address);
+    owner->address_space_lock.release();
+    return result;
+}
+
+// Keeps brk, mmap, munmap, fork and page faults away from the address space until the caller releases the returned
+// owner's address space lock
+auto thread_scheduler::acquire_address_space(memory::page_table_t *level_0_page_table) -> process * {
+    auto *owner = this->find_address_space_owner(level_0_page_table);
+    if (owner == nullptr) {
+        return nullptr;
+    }
+    owner->address_space_lock.acquire();
+    return owner;
+}
+
+// The caller holds the owner's address space lock, so the region lookup and the mapping cannot interleave with
+// another fault on the same page or with brk, mmap, munmap and fork changing the regions
+auto thread_scheduler::resolve_page_fault(process &owner, memory::page_table_t *level_0_page_table,
+                                          uintptr_t virtual_address) -> bool {
+    auto page_virtual_address = virtual_address & ~(memory::page_size - 1);
+    auto *faulting_region = find_region(owner.regions, page_virtual_address);
+    if (faulting_region == nullptr) {
+        return false;
+    }
+    auto page_physical_address = level_0_page_table->translate(page_virtual_address);
+    if (faulting_region->type == region_type_t::mapped_file) {
+        auto page_index = get_mapped_page_index(*faulting_region, page_virtual_address);
+        if (page_physical_address != 0) {
+            if (!faulting_region->writable) {
+                return false;
+            }
+            file::descriptor_interface::get().mark_mapped_page_dirty(faulting_region->index_of_inode_on_disk,
+                                                                     page_index);
+            level_0_page_table->map(page_virtual_address, memory::page_table_t::type_t::user, page_physical_address,
+                                    memory::page_size);
+            memory::virtual_memory::flush_translation_lookaside_buffer(level_0_page_table, page_virtual_address);
+            return true;
+        }
+        auto *mapped_page =
+            file::descriptor_interface::get().acquire_mapped_page(faulting_region->index_of_inode_on_disk, page_index);
+        if (mapped_page == nullptr) {
+            return false;
+        }
+        level_0_page_table->map(page_virtual_address, memory::page_table_t::type_t::read_only, mapped_page,
+                                memory::page_size);
+        return true;
+    }
+    if (faulting_region->type == region_type_t::shared_memory) {
+        if (page_physical_address != 0) {
+            if (!faulting_region->writable) {
+                return false;
+            }
+            level_0_page_table->map(page_virtual_address, memory::page_table_t::type_t::user, page_physical_address,
+                                    memory::page_size);
+            memory::virtual_memory::flush_translation_lookaside_buffer(level_0_page_table, page_virtual_address);
+            return true;
+        }
+        file::descriptor_interface::get().map_shared_memory(
+            faulting_region->shared_memory_index, level_0_page_table, page_virtual_address,
+            faulting_region->writable ? memory::page_table_t::type_t::user : memory::page_table_t::type_t::read_only,
+            get_mapped_page_index(*faulting_region, page_virtual_address), 1);
+        return level_0_page_table->translate(page_virtual_address) != 0;
+    }
+    if (page_physical_address != 0) {
+        if (faulting_region->writable && level_0_page_table->is_user_writable(page_virtual_address)) {
+            return true;
+        }
+        return level_0_page_table->resolve_copy_on_write(virtual_address);
+    }
+    auto is_image_page =
+        faulting_region->type == region_type_t::file && !faulting_region->writable &&
+        (faulting_region->file_virtual_address - faulting_region->file_offset) % memory::page_size == 0 &&
+        page_virtual_address + memory::page_size <= faulting_region->file_virtual_address + faulting_region->file_size;
+    for (auto &region : owner.regions) {
+        if (&region != faulting_region && region.type == region_type_t::file &&
+            page_virtual_address < region.virtual_address + region.number_of_pages * memory::page_size &&
+            region.virtual_address < page_virtual_address + memory::page_size) {
+            is_image_page = false;
+        }
+    }
+    if (is_image_page) {
+        auto *image_page = file::descriptor_interface::get().acquire_mapped_page(
+            faulting_region->index_of_inode_on_disk, get_mapped_page_index(*faulting_region, page_virtual_address));
+        if (image_page != nullptr) {
+            level_0_page_table->map(page_virtual_address, memory::page_table_t::type_t::read_only, image_page,
+                                    memory::page_size);
+            return true;
+        }
+    }
+
+    auto section_virtual_address = page_virtual_address & ~(memory::section_size - 1);
+    if (faulting_region->type == region_type_t::anonymous &&
+        section_virtual_address >= faulting_region->virtual_address &&
+        section_virtual_address + memory::section_size <=
+            faulting_region->virtual_address + faulting_region->number_of_pages * memory::page_size &&
+        level_0_page_table->is_section_empty(section_virtual_address)) {
+        auto section =
+            memory::buddy_allocator::get().allocate_if_available(memory::buddy_allocator_constants::section_order);
+        if (section.size() != 0) {
+            memory::zero_pages(section);
+            level_0_page_table->map(section_virtual_address,
+                                    faulting_region->writable ? memory::page_table_t::type_t::user
+                                                              : memory::page_table_t::type_t::read_only,
+                                    section.data(), memory::section_size);
+            return true;
+        }
+    }
+
+    auto *page = memory::buddy_allocator::get().allocate_zeroed<memory::page_t>(0);
+    for (auto &region : owner.regions) {
+        if (region.type != region_type_t::file) {
+            continue;
+        }
+        auto overlap_begin = page_virtual_address > region.file_virtual_address ? page_virtual_address
+                                                                                 : region.file_virtual_address;
+        auto overlap_end = page_virtual_address + memory::page_size < region.file_virtual_address + region.file_size
+                               ? page_virtual_address + memory::page_size
+                               : region.file_virtual_address + region.file_size;
+        if (overlap_begin >= overlap_end) {
+            continue;
+        }
+        auto page_span = span_t(&(*page)[overlap_begin - page_virtual_address], overlap_end - overlap_begin);
+        if (file::descriptor_interface::get().read_inode(region.index_of_inode_on_disk,
+                                                         region.file_offset +
+                                                             (overlap_begin - region.file_virtual_address),
+                                                         page_span) != page_span.size()) {
+            memory::buddy_allocator::get().deallocate(page);
+            return false;
+        }
+    }
+    level_0_page_table->map(page_virtual_address,
+                            faulting_region->writable ? memory::page_table_t::type_t::user
+                                                      : memory::page_table_t::type_t::read_only,
+                            page, memory::page_size);
+    return true;
+}
+
+auto thread_scheduler::reserve_process() -> int {
     for (int i = 0; i < thread_scheduler_constants::maximum_number_of_processes; i++) {
         auto &process = processes[i];
         process.lock.acquire();
         if (process.status == process_status::unused) {
-            new_process_id = i;
             process.status = process_status::reserved;
             process.lock.release();
-            break;
+            return i;
         }
         process.lock.release();
     }
+    return -1;
+}
+
+auto thread_scheduler::fork() -> int {
+    auto new_process_id = this->reserve_process();
     if (new_process_id == -1) {
         return -1;
     }
@@ -231,49 +485,21 @@ auto thread_scheduler::fork() -> int {
 
     new_process.parent_id = get_current_process_id();
 
-    auto *new_level_0_page_table = memory::buddy_allocator::get().allocate<memory::page_table_t>(0);
-    for (size_t i = 0; i < sizeof(memory::page_table_t) / sizeof(memory::page_table_descriptor_t); i++) {
-        new_level_0_page_table->set_descriptor_at_index(i, {});
-    }
-    for (size_t section_index = 0; section_index < memory::page_size / sizeof(section_detail_t); section_index++) {
-        auto section = (*original_process.section_details)[section_index];
-        if (section.number_of_pages > 0) {
-            for (size_t page_offset = 0; page_offset < section.number_of_pages; page_offset += 1) {
-                auto *new_page = memory::buddy_allocator::get().allocate<array_t<byte_t, memory::page_size>>(0);
-                auto original_page = section.virtual_address + page_offset * memory::page_size;
-                new_level_0_page_table->map(original_page, memory::page_table_t::type_t::user, new_page,
-                                            memory::page_size);
-                auto *physical_address_of_original_data =
-                    reinterpretable_t<uintptr_t>(original_process.level_0_page_table, original_page)
-                        .to<array_t<byte_t, memory::page_size>>();
-                for (size_t offset = 0; offset < memory::page_size; offset++) {
-                    (*new_page)[offset] = (*physical_address_of_original_data)[offset];
-                }
-            }
+    auto *new_level_0_page_table = memory::buddy_allocator::get().allocate_zeroed<memory::page_table_t>(0);
+    original_process.address_space_lock.acquire();
+    for (auto &region : original_process.regions) {
+        if (region.type != region_type_t::unused) {
+            original_process.level_0_page_table->share(new_level_0_page_table, region.virtual_address,
+                                                       region.number_of_pages * memory::page_size,
+                                                       region.writable && region.type != region_type_t::mapped_file &&
+                                                           region.type != region_type_t::shared_memory);
         }
     }
-    auto *new_stack_physical_address =
-        memory::buddy_allocator::get().allocate<array_t<byte_t, memory::user_address_space_constants::stack_size>>(
-            memory::user_address_space_constants::stack_size_order);
-    new_level_0_page_table->map(memory::user_address_space_constants::stack_begin, memory::page_table_t::type_t::user,
-                                new_stack_physical_address, memory::page_size);
-    auto *original_stack_physical_address =
-        reinterpretable_t<uintptr_t>(original_process.level_0_page_table,
-                                     memory::user_address_space_constants::stack_begin)
-            .to<array_t<byte_t, memory::user_address_space_constants::stack_size>>();
-
-    for (size_t offset = 0; offset < memory::user_address_space_constants::stack_size; offset++) {
-        (*new_stack_physical_address)[offset] = (*original_stack_physical_address)[offset];
-    }
     new_process.level_0_page_table = new_level_0_page_table;
 
-    auto *new_section_details_page =
-        memory::buddy_allocator::get()
-            .allocate<array_t<section_detail_t, memory::page_size / sizeof(section_detail_t)>>(0);
-    for (size_t i = 0; i < memory::page_size / sizeof(section_detail_t); i++) {
-        (*new_section_details_page)[i] = (*original_process.section_details)[i];
-    }
-    new_process.section_details = new_section_details_page;
+    new_process.regions = original_process.regions;
+    reference_regions(new_process.regions);
+    original_process.address_space_lock.release();
 
     auto *new_kernel_stack_begin = memory::buddy_allocator::get().allocate<kernel_stack_t>(
         memory::kernel_address_space_constants::stack_size_order);
@@ -285,6 +511,7 @@ auto thread_scheduler::fork() -> int {
     new_process.user_mode_state = &new_kernel_stack_begin->exception_frame;
 
     new_process.text_size = original_process.text_size;
+    new_process.heap_begin = original_process.heap_begin;
     new_process.heap_size = original_process.heap_size;
     new_process.stack_size = original_process.stack_size;
     new_process.condition = original_process.condition;
@@ -301,6 +528,108 @@ auto thread_scheduler::fork() -> int {
     return new_process_id;
 }
 
+auto thread_scheduler::vfork() -> int {
+    auto new_process_id = this->reserve_process();
+    if (new_process_id == -1) {
+        return -1;
+    }
+
+    auto &original_process = processes[get_current_process_id()];
+    auto &new_process = processes[new_process_id];
+
+    new_process.parent_id = get_current_process_id();
+    new_process.level_0_page_table = original_process.level_0_page_table;
+    new_process.regions = original_process.regions;
+    new_process.borrows_address_space = true;
+
+    auto *new_kernel_stack_begin = memory::buddy_allocator::get().allocate<kernel_stack_t>(
+        memory::kernel_address_space_constants::stack_size_order);
+    new_kernel_stack_begin->exception_frame = original_process.kernel_stack_begin->exception_frame;
+    new_process.kernel_stack_begin = new_kernel_stack_begin;
+
+    new_process.kernel_mode_state.set_stack_pointer(&new_kernel_stack_begin->exception_frame);
+    new_process.kernel_mode_state.set_link_pointer(process_init);
+    new_process.user_mode_state = &new_kernel_stack_begin->exception_frame;
+
+    new_process.text_size = original_process.text_size;
+    new_process.heap_begin = original_process.heap_begin;
+    new_process.heap_size = original_process.heap_size;
+    new_process.stack_size = original_process.stack_size;
+
+    new_process.user_mode_state->set_x0_field(0);
+
+    file::descriptor_interface::get().clone_file_descriptors(get_current_process_id(), new_process_id);
+    file::descriptor_interface::get().initialize_file_descriptors(new_process_id);
+
+    lock.acquire();
+    new_process.lock.acquire();
+    new_process.status = process_status::runnable;
+    new_process.lock.release();
+    while (new_process.borrows_address_space) {
+        sleep(&new_process, lock);
+    }
+    lock.release();
+
+    return new_process_id;
+}
+
+auto thread_scheduler::return_address_space(process &borrowing_process) -> void {
+    lock.acquire();
+    borrowing_process.borrows_address_space = false;
+    wake(&borrowing_process);
+    lock.release();
+}
+
+auto thread_scheduler::spawn(file::path_name_t executable_file_path,
+                             span_t<array_t<byte_t, memory::page_size> *> arguments,
+                             span_t<int32_t> file_descriptor_map) -> int {
+    auto new_process_id = this->reserve_process();
+    if (new_process_id == -1) {
+        return -1;
+    }
+
+    auto &new_process = processes[new_process_id];
+    new_process.parent_id = get_current_process_id();
+
+    auto *new_kernel_stack_begin = memory::buddy_allocator::get().allocate<kernel_stack_t>(
+        memory::kernel_address_space_constants::stack_size_order);
+    new_kernel_stack_begin->exception_frame = exception_frame_t();
+    new_process.kernel_stack_begin = new_kernel_stack_begin;
+
+    new_process.kernel_mode_state.set_stack_pointer(&new_kernel_stack_begin->exception_frame);
+    new_process.kernel_mode_state.set_link_pointer(process_init);
+    new_process.user_mode_state = &new_kernel_stack_begin->exception_frame;
+    new_process.stack_size = memory::user_address_space_constants::stack_size / memory::page_size;
+
+    if (file_descriptor_map.size() == 0) {
+        file::descriptor_interface::get().clone_file_descriptors(get_current_process_id(), new_process_id);
+        file::descriptor_interface::get().initialize_file_descriptors(new_process_id);
+    } else {
+        file::descriptor_interface::get().clone_file_descriptors(get_current_process_id(), new_process_id,
+                                                                 file_descriptor_map);
+    }
+
+    if (!this->load(new_process_id, executable_file_path, arguments)) {
+        file::descriptor_interface::get().remove_file_descriptors(new_process_id);
+        memory::buddy_allocator::get().deallocate(new_kernel_stack_begin);
+        new_process.lock.acquire();
+        new_process.status = process_status::unused;
+        new_process.parent_id = -1;
+        new_process.kernel_stack_begin = {};
+        new_process.kernel_mode_state = {};
+        new_process.user_mode_state = {};
+        new_process.stack_size = 0;
+        new_process.lock.release();
+        return -1;
+    }
+
+    new_process.lock.acquire();
+    new_process.status = process_status::runnable;
+    new_process.lock.release();
+
+    return new_process_id;
+}
+
 auto thread_scheduler::wait() -> int {
     lock.acquire();
     while (true) {
@@ -311,17 +640,19 @@ auto thread_scheduler::wait() -> int {
                 process.lock.acquire();
                 number_of_children += 1;
                 if (process.status == process_status::zombie) {
-                    deallocate_address_space(process.level_0_page_table);
-                    memory::buddy_allocator::get().deallocate(process.section_details);
+                    if (process.level_0_page_table != nullptr) {
+                        deallocate_address_space(process.level_0_page_table);
+                        release_regions(process.regions);
+                    }
                     memory::buddy_allocator::get().deallocate(process.kernel_stack_begin);
                     process.status = process_status::unused;
                     process.parent_id = -1;
                     process.level_0_page_table = {};
-                    process.section_details = {};
                     process.kernel_stack_begin = {};
                     process.kernel_mode_state = {};
                     process.user_mode_state = {};
                     process.text_size = 0;
+                    process.heap_begin = 0;
                     process.heap_size = 0;
                     process.stack_size = 0;
                     process.condition = {};
@@ -347,6 +678,12 @@ auto thread_scheduler::exit() -> void {
 
     file::descriptor_interface::get().remove_file_descriptors(get_current_process_id());
 
+    if (get_current_process().borrows_address_space) {
+        get_current_process().level_0_page_table = nullptr;
+        get_current_process().regions = region_list_t();
+        this->return_address_space(get_current_process());
+    }
+
     lock.acquire();
 
     for (int i = 0; i < thread_scheduler_constants::maximum_number_of_processes; i++) {
@@ -369,8 +706,36 @@ auto thread_scheduler::exit() -> void {
                                        &scheduler_thread_contexts[architecture::get_core_number()]);
 }
 
+using stack_pages_t = array_t<memory::page_t *, (1 << memory::user_address_space_constants::stack_size_order)>;
+constexpr size_t maximum_number_of_elf_section_headers = memory::page_size / sizeof(elf_section_header_t);
+using elf_section_header_list_t = array_t<elf_section_header_t, maximum_number_of_elf_section_headers>;
+
+auto get_stack_byte(memory::page_table_t *level_0_page_table, stack_pages_t &stack_pages, size_t offset) -> byte_t & {
+    auto *&stack_page = stack_pages[offset / memory::page_size];
+    if (stack_page == nullptr) {
+        stack_page = memory::buddy_allocator::get().allocate_zeroed<memory::page_t>(0);
+        level_0_page_table->map(memory::user_address_space_constants::stack_begin +
+                                    offset / memory::page_size * memory::page_size,
+                                memory::page_table_t::type_t::user, stack_page, memory::page_size);
+    }
+    return (*stack_page)[offset % memory::page_size];
+}
+
+auto get_argument_size(array_t<byte_t, memory::page_size> &argument) -> size_t {
+    size_t argument_size = 0;
+    while (argument_size < memory::page_size && !argument[argument_size].is_zero()) {
+        argument_size += 1;
+    }
+    return argument_size;
+}
+
 auto thread_scheduler::exec(file::path_name_t executable_file_path,
                             span_t<array_t<byte_t, memory::page_size> *> arguments) -> bool {
+    return this->load(get_current_process_id(), executable_file_path, arguments);
+}
+
+auto thread_scheduler::load(int process_id, file::path_name_t executable_file_path,
+                            span_t<array_t<byte_t, memory::page_size> *> arguments) -> bool {
     auto file_descriptor =
         file::descriptor_interface::get().open(thread_scheduler::get().get_current_process_id(), executable_file_path,
                                                true, false, file::open_mode_t::do_not_create);
@@ -390,143 +755,382 @@ auto thread_scheduler::exec(file::path_name_t executable_file_path,
         return false;
     }
 
-    auto *level_0_page_table = memory::buddy_allocator::get().allocate<page_table_t>(0);
-    for (size_t i = 0; i < sizeof(memory::page_table_t) / sizeof(memory::page_table_descriptor_t); i++) {
-        level_0_page_table->set_descriptor_at_index(i, {});
+    auto number_of_elf_section_headers = elf_header.get_phnum_field();
+    if (number_of_elf_section_headers > maximum_number_of_elf_section_headers) {
+        file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
+        return false;
     }
-
-    auto *section_details = memory::buddy_allocator::get()
-                                .allocate<array_t<section_detail_t, memory::page_size / sizeof(section_detail_t)>>(0);
-    for (size_t i = 0; i < memory::page_size / sizeof(section_detail_t); i++) {
-        (*section_details)[i] = section_detail_t();
+    auto *elf_section_headers = memory::buddy_allocator::get().allocate<elf_section_header_list_t>(0);
+    auto elf_section_headers_span = span_t(&(*elf_section_headers)[0], number_of_elf_section_headers);
+    if (file::descriptor_interface::get().read_at(thread_scheduler::get().get_current_process_id(), file_descriptor,
+                                                  elf_header.get_phoff_field(),
+                                                  as_writable_bytes(elf_section_headers_span)) !=
+        number_of_elf_section_headers * sizeof(elf_section_header_t)) {
+        memory::buddy_allocator::get().deallocate(elf_section_headers);
+        file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
+        return false;
     }
 
-    elf_section_header_t elf_section_header{};
-    auto elf_section_header_span = span_t(&elf_section_header, 1);
-    int next_empty_section_detail_index = 0;
-    for (uint64_t i = 0, offset = elf_header.get_phoff_field(); i < elf_header.get_phnum_field();
-         i++, offset += sizeof(elf_section_header_t)) {
-        file::descriptor_interface::get().seek(thread_scheduler::get().get_current_process_id(), file_descriptor, true,
-                                               offset, false, 0);
-        if (file::descriptor_interface::get().read(thread_scheduler::get().get_current_process_id(), file_descriptor,
-                                                   as_writable_bytes(elf_section_header_span)) !=
-            sizeof(elf_section_header_t)) {
-            deallocate_address_space(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
-            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
-            return false;
-        }
-        if (!elf_section_header.is_loadable()) {
-            level_0_page_table->clear();
-            memory::buddy_allocator::get().deallocate(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
-            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
-            return false;
-        }
-        if (elf_section_header.get_memsz_field() < elf_section_header.get_filesz_field()) {
-            level_0_page_table->clear();
-            memory::buddy_allocator::get().deallocate(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
-            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
-            return false;
-        }
-        if (elf_section_header.get_vaddr_field() + elf_section_header.get_memsz_field() <
-            elf_section_header.get_vaddr_field()) {
-            level_0_page_table->clear();
-            memory::buddy_allocator::get().deallocate(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
-            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
-            return false;
+    region_list_t regions{};
+    int next_empty_region_index = 0;
+    for (auto &elf_section_header : elf_section_headers_span) {
+        if (!elf_section_header.is_loadable() || elf_section_header.get_memsz_field() == 0) {
+            continue;
         }
-        if (elf_section_header.get_memsz_field() > memory::page_size) {
-            level_0_page_table->clear();
-            memory::buddy_allocator::get().deallocate(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
+        if (elf_section_header.get_memsz_field() < elf_section_header.get_filesz_field() ||
+            elf_section_header.get_vaddr_field() < memory::page_size ||
+            elf_section_header.get_memsz_field() > memory::user_address_space_constants::mapping_begin ||
+            elf_section_header.get_vaddr_field() >
+                memory::user_address_space_constants::mapping_begin - elf_section_header.get_memsz_field() ||
+            next_empty_region_index + 2 >= thread_scheduler_constants::maximum_number_of_regions) {
+            release_regions(regions);
+            memory::buddy_allocator::get().deallocate(elf_section_headers);
             file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
             return false;
         }
 
-        auto section_size_in_number_of_pages = elf_section_header.get_filesz_field() % memory::page_size == 0
-                                                   ? elf_section_header.get_filesz_field() / memory::page_size
-                                                   : elf_section_header.get_filesz_field() / memory::page_size + 1;
-        (*section_details)[next_empty_section_detail_index] =
-            section_detail_t{elf_section_header.get_vaddr_field(), section_size_in_number_of_pages};
-        next_empty_section_detail_index += 1;
+        auto region_begin = elf_section_header.get_vaddr_field() & ~(memory::page_size - 1);
+        auto region_end = elf_section_header.get_vaddr_field() + elf_section_header.get_memsz_field();
+        auto &region = regions[next_empty_region_index];
+        region.type = region_type_t::file;
+        region.virtual_address = region_begin;
+        region.number_of_pages = (region_end - region_begin + memory::page_size - 1) / memory::page_size;
+        region.index_of_inode_on_disk = file::descriptor_interface::get().reference_inode(
+            thread_scheduler::get().get_current_process_id(), file_descriptor);
+        region.file_virtual_address = elf_section_header.get_vaddr_field();
+        region.file_offset = elf_section_header.get_off_field();
+        region.file_size = elf_section_header.get_filesz_field();
+        region.writable = elf_section_header.is_writable();
+        next_empty_region_index += 1;
+    }
 
-        auto *page = reinterpretable_t<uintptr_t>(level_0_page_table, elf_section_header.get_vaddr_field())
-                         .to<array_t<byte_t, memory::page_size>>();
-        if (page == nullptr) {
-            page = memory::buddy_allocator::get().allocate<array_t<byte_t, memory::page_size>>(0);
-            for (size_t i = 0; i < memory::page_size; i++) {
-                (*page)[i].set_value(0);
-            }
-            level_0_page_table->map(elf_section_header.get_vaddr_field(), memory::page_table_t::type_t::user, page,
-                                    elf_section_header.get_filesz_field());
-        }
-
-        auto *address_to_read_into = &(*page)[elf_section_header.get_vaddr_field() % memory::page_size];
-        auto elf_section_span = span_t(address_to_read_into, elf_section_header.get_filesz_field());
-        file::descriptor_interface::get().seek(thread_scheduler::get().get_current_process_id(), file_descriptor, true,
-                                               elf_section_header.get_off_field(), false, 0);
-        if (file::descriptor_interface::get().read(thread_scheduler::get().get_current_process_id(), file_descriptor,
-                                                   elf_section_span) != elf_section_header.get_filesz_field()) {
-            level_0_page_table->clear();
-            memory::buddy_allocator::get().deallocate(level_0_page_table);
-            memory::buddy_allocator::get().deallocate(section_details);
-            file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
-            return false;
+    memory::buddy_allocator::get().deallocate(elf_section_headers);
+    file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
+
+    uintptr_t heap_begin = 0;
+    for (auto &region : regions) {
+        if (region.type != region_type_t::unused &&
+            region.virtual_address + region.number_of_pages * memory::page_size > heap_begin) {
+            heap_begin = region.virtual_address + region.number_of_pages * memory::page_size;
         }
     }
 
-    file::descriptor_interface::get().close(thread_scheduler::get().get_current_process_id(), file_descriptor);
+    regions[next_empty_region_index].type = region_type_t::anonymous;
+    regions[next_empty_region_index].virtual_address = memory::user_address_space_constants::stack_begin;
+    regions[next_empty_region_index].number_of_pages = 1 << memory::user_address_space_constants::stack_size_order;
+    next_empty_region_index += 1;
 
-    (*section_details)[next_empty_section_detail_index] = section_detail_t{
-        memory::user_address_space_constants::stack_begin, 1 << memory::user_address_space_constants::stack_size_order};
-    next_empty_section_detail_index += 1;
+    regions[next_empty_region_index].type = region_type_t::anonymous;
+    regions[next_empty_region_index].virtual_address = heap_begin;
+    next_empty_region_index += 1;
 
-    auto *new_stack =
-        memory::buddy_allocator::get().allocate<array_t<byte_t, memory::user_address_space_constants::stack_size>>(
-            memory::user_address_space_constants::stack_size_order);
-    level_0_page_table->map(memory::user_address_space_constants::stack_begin, memory::page_table_t::type_t::user,
-                            new_stack, memory::user_address_space_constants::stack_size);
-    auto offset = memory::user_address_space_constants::stack_size;
+    // Each argument takes its bytes and a terminator; the strings and the pointer array must fit on the stack
     size_t number_of_arguments = 0;
+    size_t arguments_size = 0;
+    for (int i = 0; i < thread_scheduler_constants::maximum_number_of_arguments && arguments[i] != nullptr; i++) {
+        arguments_size += get_argument_size(*arguments[i]) + 1;
+        number_of_arguments += 1;
+    }
+    arguments_size = (arguments_size + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1);
+    if (arguments_size + number_of_arguments * sizeof(uintptr_t) > memory::user_address_space_constants::stack_size) {
+        release_regions(regions);
+        return false;
+    }
+
+    auto *level_0_page_table = memory::buddy_allocator::get().allocate_zeroed<page_table_t>(0);
+
+    stack_pages_t new_stack_pages{};
+    auto offset = memory::user_address_space_constants::stack_size;
     array_t<uintptr_t, thread_scheduler_constants::maximum_number_of_arguments> user_space_argument_addresses = {};
 
-    for (int i = 0; arguments[i] != nullptr; i++) {
-        auto *argument = arguments[i];
-        int argument_size = 0;
-        for (int j = 0; argument != nullptr && !(*argument)[j].is_zero(); j++) {
-            argument_size += 1;
-        }
-        offset -= argument_size * sizeof(uintptr_t);
-        for (int j = 0; j < argument_size; j++) {
-            (*new_stack)[offset + j] = (*argument)[j];
+    for (size_t i = 0; i < number_of_arguments; i++) {
+        auto &argument = *arguments[i];
+        auto argument_size = get_argument_size(argument);
+        offset -= argument_size + 1;
+        for (size_t j = 0; j < argument_size; j++) {
+            get_stack_byte(level_0_page_table, new_stack_pages, offset + j) = argument[j];
         }
-        user_space_argument_addresses[number_of_arguments] = memory::user_address_space_constants::stack_begin + offset;
-        number_of_arguments += 1;
+        get_stack_byte(level_0_page_table, new_stack_pages, offset + argument_size).set_value(0);
+        user_space_argument_addresses[i] = memory::user_address_space_constants::stack_begin + offset;
     }
+    offset &= ~(sizeof(uintptr_t) - 1);
     offset -= number_of_arguments * sizeof(uintptr_t);
     for (size_t i = 0; i < number_of_arguments; i++) {
         for (size_t j = 0; j < sizeof(uintptr_t); j++) {
-            (*new_stack)[offset + i * sizeof(uintptr_t) + j] =
+            get_stack_byte(level_0_page_table, new_stack_pages, offset + i * sizeof(uintptr_t) + j) =
                 as_writable_bytes(span_t(&user_space_argument_addresses[i], 1))[j];
         }
     }
 
-    deallocate_address_space(get_current_process().level_0_page_table);
-    get_current_process().level_0_page_table = level_0_page_table;
-
-    memory::buddy_allocator::get().deallocate(get_current_process().section_details);
-    get_current_process().section_details = section_details;
+    auto &target_process = processes[process_id];
+    file::descriptor_interface::get().close_rings(process_id);
+    auto *original_level_0_page_table = target_process.level_0_page_table;
+    target_process.level_0_page_table = level_0_page_table;
+    if (target_process.borrows_address_space) {
+        target_process.regions = regions;
+        this->return_address_space(target_process);
+    } else {
+        if (original_level_0_page_table != nullptr) {
+            deallocate_address_space(original_level_0_page_table);
+        }
+        release_regions(target_process.regions);
+        target_process.regions = regions;
+    }
+    target_process.heap_begin = heap_begin;
+    target_process.heap_size = 0;
 
-    get_current_process().user_mode_state->set_elr_field(elf_header.get_entry_field());
-    get_current_process().user_mode_state->reset_spsr_field();
-    get_current_process().user_mode_state->set_sp_field(memory::user_address_space_constants::stack_begin + offset);
-    get_current_process().user_mode_state->set_x0_field(number_of_arguments);
-    get_current_process().user_mode_state->set_x1_field(memory::user_address_space_constants::stack_begin + offset);
+    target_process.user_mode_state->set_elr_field(elf_header.get_entry_field());
+    target_process.user_mode_state->reset_spsr_field();
+    target_process.user_mode_state->set_sp_field(memory::user_address_space_constants::stack_begin + offset);
+    target_process.user_mode_state->set_x0_field(number_of_arguments);
+    target_process.user_mode_state->set_x1_field(memory::user_address_space_constants::stack_begin + offset);
 
     return true;
 };
 
+auto is_range_free(region_list_t &regions, uintptr_t begin, uintptr_t end, region_t *ignored_region) -> bool {
+    for (auto &region : regions) {
+        if (region.type != region_type_t::unused && &region != ignored_region &&
+            begin < region.virtual_address + region.number_of_pages * memory::page_size &&
+            region.virtual_address < end) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto thread_scheduler::brk(uintptr_t new_break) -> uintptr_t {
+    auto &current_process = get_current_process();
+    current_process.address_space_lock.acquire();
+    auto current_break = current_process.heap_begin + current_process.heap_size;
+    region_t *heap_region = nullptr;
+    for (auto &region : current_process.regions) {
+        if (region.type == region_type_t::anonymous && region.virtual_address == current_process.heap_begin) {
+            heap_region = &region;
+            break;
+        }
+    }
+    if (heap_region == nullptr || new_break < current_process.heap_begin ||
+        new_break > memory::user_address_space_constants::mapping_begin) {
+        current_process.address_space_lock.release();
+        return current_break;
+    }
+    auto new_number_of_pages = (new_break - current_process.heap_begin + memory::page_size - 1) / memory::page_size;
+    auto new_heap_end = current_process.heap_begin + new_number_of_pages * memory::page_size;
+    if (new_number_of_pages > heap_region->number_of_pages &&
+        !is_range_free(current_process.regions, current_process.heap_begin, new_heap_end, heap_region)) {
+        current_process.address_space_lock.release();
+        return current_break;
+    }
+    if (new_number_of_pages < heap_region->number_of_pages) {
+        current_process.level_0_page_table->release(
+            new_heap_end, (heap_region->number_of_pages - new_number_of_pages) * memory::page_size);
+    }
+    heap_region->number_of_pages = new_number_of_pages;
+    current_process.heap_size = new_break - current_process.heap_begin;
+    current_process.address_space_lock.release();
+    return new_break;
+}
+
+auto thread_scheduler::sbrk(int64_t increment) -> uintptr_t {
+    auto &current_process = get_current_process();
+    auto current_break = current_process.heap_begin + current_process.heap_size;
+    auto new_break = current_break + increment;
+    if ((increment < 0 && new_break > current_break) || (increment > 0 && new_break < current_break) ||
+        this->brk(new_break) != new_break) {
+        return UINTPTR_MAX;
+    }
+    return current_break;
+}
+
+auto thread_scheduler::mmap(uintptr_t address, size_t size, uint32_t flags, int file_descriptor_index, size_t offset)
+    -> uintptr_t {
+    auto &current_process = get_current_process();
+    if (size == 0 || size > memory::user_address_space_constants::mapping_end -
+                                memory::user_address_space_constants::mapping_begin) {
+        return UINTPTR_MAX;
+    }
+    auto is_anonymous = (flags & thread_scheduler_constants::map_anonymous) != 0;
+    auto is_writable = (flags & thread_scheduler_constants::map_writable) != 0;
+    auto is_shared = (flags & thread_scheduler_constants::map_shared) != 0;
+    if (is_anonymous && file_descriptor_index != -1) {
+        return UINTPTR_MAX;
+    }
+    if (!is_anonymous) {
+        if (file_descriptor_index < 0 ||
+            file_descriptor_index >=
+                file::descriptor_interface_constants::maximum_number_of_file_descriptors_per_process ||
+            offset % memory::page_size != 0 || (is_writable && !is_shared)) {
+            return UINTPTR_MAX;
+        }
+        auto status = file::descriptor_interface::get().status(get_current_process_id(), file_descriptor_index);
+        if (status.file_descriptor_type == file::file_descriptor_type_t::shared_memory) {
+            if (!is_shared || offset > status.size || size > status.size - offset) {
+                return UINTPTR_MAX;
+            }
+        } else if (status.file_descriptor_type != file::file_descriptor_type_t::inode ||
+                   status.inode_type != file::inode_type_t::file || !status.readable ||
+                   (is_writable && !status.writable)) {
+            return UINTPTR_MAX;
+        }
+    }
+    auto number_of_pages = (size + memory::page_size - 1) / memory::page_size;
+    current_process.address_space_lock.acquire();
+    region_t *new_region = nullptr;
+    for (auto &region : current_process.regions) {
+        if (region.type == region_type_t::unused) {
+            new_region = &region;
+            break;
+        }
+    }
+    if (new_region == nullptr) {
+        current_process.address_space_lock.release();
+        return UINTPTR_MAX;
+    }
+    auto candidate = memory::user_address_space_constants::mapping_begin;
+    if (address % memory::page_size == 0 && address >= memory::user_address_space_constants::mapping_begin &&
+        address <= memory::user_address_space_constants::mapping_end - number_of_pages * memory::page_size &&
+        is_range_free(current_process.regions, address, address + number_of_pages * memory::page_size, nullptr)) {
+        candidate = address;
+    }
+    auto is_section_aligned = is_anonymous && number_of_pages * memory::page_size >= memory::section_size;
+    while (candidate <= memory::user_address_space_constants::mapping_end - number_of_pages * memory::page_size) {
+        auto candidate_end = candidate + number_of_pages * memory::page_size;
+        region_t *overlapping_region = nullptr;
+        for (auto &region : current_process.regions) {
+            if (region.type != region_type_t::unused &&
+                candidate < region.virtual_address + region.number_of_pages * memory::page_size &&
+                region.virtual_address < candidate_end) {
+                overlapping_region = &region;
+                break;
+            }
+        }
+        if (overlapping_region == nullptr) {
+            new_region->type = region_type_t::anonymous;
+            new_region->virtual_address = candidate;
+            new_region->number_of_pages = number_of_pages;
+            new_region->writable = is_writable;
+            if (!is_anonymous) {
+                new_region->type = region_type_t::mapped_file;
+                new_region->shared_memory_index = file::descriptor_interface::get().reference_shared_memory(
+                    get_current_process_id(), file_descriptor_index);
+                if (new_region->shared_memory_index != -1) {
+                    new_region->type = region_type_t::shared_memory;
+                } else {
+                    new_region->index_of_inode_on_disk = file::descriptor_interface::get().reference_inode(
+                        get_current_process_id(), file_descriptor_index);
+                }
+                new_region->file_virtual_address = candidate;
+                new_region->file_offset = offset;
+                new_region->file_size = size;
+            }
+            if (new_region->type == region_type_t::shared_memory) {
+                file::descriptor_interface::get().map_shared_memory(
+                    new_region->shared_memory_index, current_process.level_0_page_table, candidate,
+                    is_writable ? memory::page_table_t::type_t::user : memory::page_table_t::type_t::read_only,
+                    offset / memory::page_size, number_of_pages);
+            }
+            current_process.address_space_lock.release();
+            return candidate;
+        }
+        candidate = overlapping_region->virtual_address + overlapping_region->number_of_pages * memory::page_size;
+        if (is_section_aligned) {
+            candidate = (candidate + memory::section_size - 1) & ~(memory::section_size - 1);
+        }
+    }
+    current_process.address_space_lock.release();
+    return UINTPTR_MAX;
+}
+
+auto thread_scheduler::munmap(uintptr_t address, size_t size) -> bool {
+    auto &current_process = get_current_process();
+    auto end = address + (size + memory::page_size - 1) / memory::page_size * memory::page_size;
+    if (address % memory::page_size != 0 || size == 0 || end < address ||
+        address < memory::user_address_space_constants::mapping_begin ||
+        end > memory::user_address_space_constants::mapping_end) {
+        return false;
+    }
+    current_process.address_space_lock.acquire();
+    size_t number_of_unused_regions = 0;
+    size_t number_of_regions_to_split = 0;
+    for (auto &region : current_process.regions) {
+        auto region_end = region.virtual_address + region.number_of_pages * memory::page_size;
+        if (region.type == region_type_t::unused) {
+            number_of_unused_regions += 1;
+        } else if (address > region.virtual_address && end < region_end) {
+            number_of_regions_to_split += 1;
+        }
+    }
+    if (number_of_regions_to_split > number_of_unused_regions) {
+        current_process.address_space_lock.release();
+        return false;
+    }
+    for (auto &region : current_process.regions) {
+        auto region_end = region.virtual_address + region.number_of_pages * memory::page_size;
+        if (region.type == region_type_t::unused || end <= region.virtual_address || region_end <= address) {
+            continue;
+        }
+        auto overlap_begin = address > region.virtual_address ? address : region.virtual_address;
+        auto overlap_end = end < region_end ? end : region_end;
+        current_process.level_0_page_table->release(overlap_begin, overlap_end - overlap_begin);
+        if (region.type == region_type_t::mapped_file) {
+            file::descriptor_interface::get().synchronize_mapped_pages(
+                region.index_of_inode_on_disk, get_mapped_page_index(region, overlap_begin),
+                (overlap_end - overlap_begin) / memory::page_size);
+        }
+        if (overlap_begin == region.virtual_address && overlap_end == region_end) {
+            if (region.type == region_type_t::file || region.type == region_type_t::mapped_file) {
+                file::descriptor_interface::get().release_inode(region.index_of_inode_on_disk);
+            }
+            if (region.type == region_type_t::shared_memory) {
+                file::descriptor_interface::get().release_shared_memory(region.shared_memory_index);
+            }
+            region = region_t();
+        } else if (overlap_begin == region.virtual_address) {
+            region.virtual_address = overlap_end;
+            region.number_of_pages = (region_end - overlap_end) / memory::page_size;
+        } else if (overlap_end == region_end) {
+            region.number_of_pages = (overlap_begin - region.virtual_address) / memory::page_size;
+        } else {
+            for (auto &new_region : current_process.regions) {
+                if (new_region.type == region_type_t::unused) {
+                    new_region = region;
+                    new_region.virtual_address = overlap_end;
+                    new_region.number_of_pages = (region_end - overlap_end) / memory::page_size;
+                    if (new_region.type == region_type_t::file || new_region.type == region_type_t::mapped_file) {
+                        file::descriptor_interface::get().reference_inode(new_region.index_of_inode_on_disk);
+                    }
+                    if (new_region.type == region_type_t::shared_memory) {
+                        file::descriptor_interface::get().reference_shared_memory(new_region.shared_memory_index);
+                    }
+                    break;
+                }
+            }
+            region.number_of_pages = (overlap_begin - region.virtual_address) / memory::page_size;
+        }
+    }
+    current_process.address_space_lock.release();
+    return true;
+}
+
+auto thread_scheduler::msync(uintptr_t address, size_t size) -> bool {
+    auto &current_process = get_current_process();
+    auto end = address + (size + memory::page_size - 1) / memory::page_size * memory::page_size;
+    if (address % memory::page_size != 0 || end < address) {
+        return false;
+    }
+    for (auto &region : current_process.regions) {
+        auto region_end = region.virtual_address + region.number_of_pages * memory::page_size;
+        if (region.type != region_type_t::mapped_file || end <= region.virtual_address || region_end <= address) {
+            continue;
+        }
+        auto overlap_begin = address > region.virtual_address ? address : region.virtual_address;
+        auto overlap_end = end < region_end ? end : region_end;
+        file::descriptor_interface::get().synchronize_mapped_pages(region.index_of_inode_on_disk,
+                                                                   get_mapped_page_index(region, overlap_begin),
+                                                                   (overlap_end - overlap_begin) / memory::page_size);
+    }
+    return true;
+}
+
 } // namespace process
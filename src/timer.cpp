@@ -24,6 +24,12 @@ inline auto read_cntfrq_el0() -> uint64_t {
     return value;
 }
 
+inline auto read_cntvct_el0() -> uint64_t {
+    uint64_t value = 0;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+
 inline void write_cntv_tval_el0(uint64_t value) {
     asm volatile("msr cntv_tval_el0, %0" : : "r"(value));
 }
@@ -64,6 +70,10 @@ auto timer::now() const -> uint64_t {
     return this->time / architecture::number_of_cores;
 }
 
+auto timer::now_in_microseconds() -> uint64_t {
+    return read_cntvct_el0() / (read_cntfrq_el0() / timer_prescaler);
+}
+
 auto timer::interrupt() -> void {
     timer::get().reload();
     this->lock.acquire();
@@ -1,5 +1,6 @@
 #include "../include/transmission_control_protocol.hpp"
 #include "../include/internet_protocol.hpp"
+#include "../include/kernel_allocator.hpp"
 #include "../include/multiprocessing.hpp"
 #include "../include/panic.hpp"
 
@@ -11,11 +12,11 @@ auto get_new_initial_sequence_number() -> uint32_t {
 
 auto transmission_control_protocol_t::receive(packet_buffer_t *packet_buffer_address,
                                               internet_protocol_packet_header_t internet_protocol_header) -> void {
-    auto *temporary_buffer = memory::buddy_allocator::get().allocate<byte_t>(0);
-
     auto padding_size = packet_buffer_address->get_length() -
                         (internet_protocol_header.get_total_length_field() - sizeof(internet_protocol_packet_header_t));
+    auto *temporary_buffer = memory::kmalloc<byte_t>(padding_size);
     packet_buffer_address->pop_back(span_t(temporary_buffer, padding_size));
+    memory::kfree(temporary_buffer);
 
     transmission_control_protocol_header_t transmission_control_protocol_header = {};
     if (!packet_buffer_address->pop_front(as_writable_bytes(span_t(&transmission_control_protocol_header, 1)))) {
@@ -24,9 +25,9 @@ auto transmission_control_protocol_t::receive(packet_buffer_t *packet_buffer_add
 
     size_t size_of_options = (transmission_control_protocol_header.get_data_offset_field() >> 4) * sizeof(uint32_t) -
                              sizeof(transmission_control_protocol_header_t);
+    temporary_buffer = memory::kmalloc<byte_t>(size_of_options);
     packet_buffer_address->pop_front(span_t(temporary_buffer, size_of_options));
-
-    memory::buddy_allocator::get().deallocate(temporary_buffer);
+    memory::kfree(temporary_buffer);
 
     auto transmission_control_block_index =
         transmission_control_protocol_t::get().get_transmission_control_block_index_by_address(
@@ -88,15 +89,15 @@ auto transmission_control_protocol_t::transmit(
     packet_buffer_address->pop_front(as_writable_bytes(span_t(&header, 1)));
     header.set_checksum_field(checksum);
 
-    auto *temporary_buffer = memory::buddy_allocator::get().allocate<byte_t>(0);
     auto temporary_buffer_size = packet_buffer_address->get_length();
+    auto *temporary_buffer = memory::kmalloc<byte_t>(temporary_buffer_size);
     packet_buffer_address->pop_back(span_t(temporary_buffer, temporary_buffer_size));
     packet_buffer_address->push_back(span_t(temporary_buffer, temporary_buffer_size));
     packet_buffer_address->push_front(as_writable_bytes(span_t(&header, 1)));
     auto *packet_buffer_address_for_retransmission = packet_buffer_t::allocate();
     packet_buffer_address_for_retransmission->push_back(span_t(temporary_buffer, temporary_buffer_size));
     packet_buffer_address_for_retransmission->push_front(as_writable_bytes(span_t(&header, 1)));
-    memory::buddy_allocator::get().deallocate(temporary_buffer);
+    memory::kfree(temporary_buffer);
 
     if (packet_configuration.syn || packet_configuration.fin || temporary_buffer_size > 0) {
         packet_buffer_address_for_retransmission->push_front(
@@ -122,10 +123,10 @@ auto transmission_control_protocol_t::timeout() -> void {
                         as_writable_bytes(span_t(&destination_internet_protocol_address, 1)));
 
                     transmission_control_protocol_header_t transmission_control_protocol_header = {};
-                    auto *temporary_buffer = memory::buddy_allocator::get().allocate<byte_t>(0);
                     packet_buffer_address->pop_front(
                         as_writable_bytes(span_t(&transmission_control_protocol_header, 1)));
                     auto temporary_buffer_size = packet_buffer_address->get_length();
+                    auto *temporary_buffer = memory::kmalloc<byte_t>(temporary_buffer_size);
                     packet_buffer_address->pop_back(span_t(temporary_buffer, temporary_buffer_size));
                     packet_buffer_address->push_back(span_t(temporary_buffer, temporary_buffer_size));
                     packet_buffer_address->push_front(
@@ -141,7 +142,7 @@ auto transmission_control_protocol_t::timeout() -> void {
                         span_t(temporary_buffer, temporary_buffer_size));
                     packet_buffer_address_for_retransmission->push_front(
                         as_writable_bytes(span_t(&transmission_control_protocol_header, 1)));
-                    memory::buddy_allocator::get().deallocate(temporary_buffer);
+                    memory::kfree(temporary_buffer);
 
                     internet_protocol_t::transmit(packet_buffer_address_for_retransmission,
                                                   protocol_type_t::transmission_control_protocol,
@@ -173,6 +174,51 @@ auto transmission_control_protocol_t::sleep_until_established(size_t transmissio
     return is_established;
 }
 
+auto transmission_control_protocol_t::is_pending(size_t transmission_control_block_index) -> bool {
+    auto &transmission_control_block =
+        transmission_control_protocol_t::get().transmission_control_blocks[transmission_control_block_index];
+    transmission_control_block.lock.acquire();
+    auto is_pending = transmission_control_block.state == connection_state_t::listen ||
+                      transmission_control_block.state == connection_state_t::syn_sent ||
+                      transmission_control_block.state == connection_state_t::syn_received;
+    transmission_control_block.lock.release();
+    return is_pending;
+}
+
+auto transmission_control_protocol_t::poll(size_t transmission_control_block_index, bool listening)
+    -> synchronization::readiness_t {
+    auto &transmission_control_block =
+        transmission_control_protocol_t::get().transmission_control_blocks[transmission_control_block_index];
+    synchronization::readiness_t readiness = {};
+    readiness.condition = &transmission_control_block;
+    transmission_control_block.lock.acquire();
+    switch (transmission_control_block.state) {
+    case connection_state_t::listen:
+    case connection_state_t::syn_sent:
+    case connection_state_t::syn_received:
+        break;
+    case connection_state_t::established:
+    case connection_state_t::fin_wait_1:
+    case connection_state_t::fin_wait_2:
+        readiness.readable = listening || transmission_control_block.received_data_queue.length() > 0;
+        readiness.writable = !listening;
+        break;
+    case connection_state_t::close_wait:
+        readiness.readable = true;
+        readiness.writable = !listening;
+        break;
+    case connection_state_t::closed:
+    case connection_state_t::closing:
+    case connection_state_t::last_ack:
+    case connection_state_t::time_wait:
+        readiness.readable = true;
+        readiness.closed = true;
+        break;
+    }
+    transmission_control_block.lock.release();
+    return readiness;
+}
+
 auto transmission_control_protocol_t::open_connection(request_t *request_address) -> void {
     for (size_t transmission_control_block_index = 0;
          transmission_control_block_index < transmission_control_protocol_constants::maximum_number_of_connections;
@@ -319,6 +365,13 @@ auto transmission_control_protocol_t::receive_data(request_t *request_address) -
     case connection_state_t::listen:
     case connection_state_t::syn_sent:
     case connection_state_t::syn_received: {
+        if (!request_address->blocking) {
+            request_address->lock.acquire();
+            request_address->status = request_status_t::would_block;
+            process::thread_scheduler::get().wake(request_address);
+            request_address->lock.release();
+            return;
+        }
         transmission_control_block.receive_request_addresses.enqueue(request_address);
         return;
     }
@@ -357,6 +410,11 @@ auto transmission_control_protocol_t::receive_data(request_t *request_address) -
                 request_address->status = request_status_t::completed;
                 process::thread_scheduler::get().wake(request_address);
                 request_address->lock.release();
+            } else if (!request_address->blocking) {
+                request_address->lock.acquire();
+                request_address->status = request_status_t::would_block;
+                process::thread_scheduler::get().wake(request_address);
+                request_address->lock.release();
             } else {
                 transmission_control_block.receive_request_addresses.enqueue(request_address);
             }
@@ -421,6 +479,14 @@ auto transmission_control_protocol_t::transmit_data(request_t *request_address)
     }
     case connection_state_t::syn_sent:
     case connection_state_t::syn_received:
+        if (!request_address->blocking) {
+            request_address->lock.acquire();
+            request_address->status = request_status_t::would_block;
+            process::thread_scheduler::get().wake(request_address);
+            request_address->lock.release();
+            return;
+        }
+        [[fallthrough]];
     case connection_state_t::established:
     case connection_state_t::close_wait: {
         transmission_control_block.lock.acquire();
@@ -1051,6 +1117,7 @@ auto transmission_control_protocol_t::handle_segment_arrival_in_other_states(
             }
             if (packet_buffer_address != nullptr) {
                 transmission_control_block.received_data_queue.enqueue(packet_buffer_address);
+                process::thread_scheduler::get().wake(&transmission_control_block);
             }
             if (transmission_control_block.receive_request_addresses.length() > 0 &&
                 transmission_control_block.receive_request_addresses.front()->number_of_bytes_transferred > 0) {
@@ -1241,6 +1308,13 @@ auto transmission_control_protocol_t::handle_transmit_requests() -> void {
                 transmission_control_block.next_uint32_to_transmit += number_of_bytes_to_transfer;
             }
             request_address->acknowledgement_sequence_number = transmission_control_block.next_uint32_to_transmit - 1;
+            if (!request_address->blocking) {
+                request_address->status = request_status_t::completed;
+                process::thread_scheduler::get().wake(request_address);
+                request_address->lock.release();
+                request_address = transmission_control_block.transmit_request_addresses.dequeue();
+                continue;
+            }
             request_address->lock.release();
             transmission_control_block.transmitted_request_addresses.enqueue(request_address);
             request_address = transmission_control_block.transmit_request_addresses.dequeue();
@@ -1,5 +1,6 @@
 #include "../include/user_datagram_protocol.hpp"
 #include "../include/internet_protocol.hpp"
+#include "../include/kernel_allocator.hpp"
 #include "../include/panic.hpp"
 
 namespace networking {
@@ -21,9 +22,10 @@ auto user_datagram_protocol_t::receive(packet_buffer_t *packet_buffer_address, u
         packet_buffer_t::deallocate(packet_buffer_address);
         return;
     }
-    auto *temporary_buffer = memory::buddy_allocator::get().allocate<byte_t>(0);
-    packet_buffer_address->pop_back(span_t(temporary_buffer, packet_buffer_address->get_length() - length));
-    memory::buddy_allocator::get().deallocate(temporary_buffer);
+    auto padding_size = packet_buffer_address->get_length() - length;
+    auto *temporary_buffer = memory::kmalloc<byte_t>(padding_size);
+    packet_buffer_address->pop_back(span_t(temporary_buffer, padding_size));
+    memory::kfree(temporary_buffer);
     for (auto &connection : user_datagram_protocol_t::get().connections) {
         if (connection.source_port_number == header.get_destination_port_field()) {
             auto *request_address = connection.receive_request_addresses.dequeue();
@@ -48,6 +50,7 @@ auto user_datagram_protocol_t::receive(packet_buffer_t *packet_buffer_address, u
                 packet_buffer_address->push_front(as_writable_bytes(span_t(&header, 1)));
                 packet_buffer_address->push_front(as_writable_bytes(span_t(&source_internet_protocol_address, 1)));
                 connection.received_packets.enqueue(packet_buffer_address);
+                process::thread_scheduler::get().wake(&connection);
             }
             return;
         }
@@ -164,6 +167,11 @@ auto user_datagram_protocol_t::request(request_t *request_address) -> void {
                     request_address->destination_port_number = user_datagram_protocol_header.get_source_port_field();
                     process::thread_scheduler::get().wake(request_address);
                     request_address->lock.release();
+                } else if (!request_address->blocking) {
+                    request_address->lock.acquire();
+                    request_address->status = request_status_t::would_block;
+                    process::thread_scheduler::get().wake(request_address);
+                    request_address->lock.release();
                 } else {
                     connection.receive_request_addresses.enqueue(request_address);
                 }
@@ -227,4 +235,13 @@ auto user_datagram_protocol_t::handle_transmit_requests() -> void {
     }
 }
 
+auto user_datagram_protocol_t::poll(size_t connection_index) -> synchronization::readiness_t {
+    auto &connection = user_datagram_protocol_t::get().connections[connection_index];
+    synchronization::readiness_t readiness = {};
+    readiness.readable = connection.received_packets.length() > 0;
+    readiness.writable = true;
+    readiness.condition = &connection;
+    return readiness;
+}
+
 } // namespace networking
@@ -0,0 +1,194 @@
+#include "../include/user_memory.hpp"
+#include "../include/buddy_allocator.hpp"
+#include "../include/reinterpretable.hpp"
+#include "../include/thread_scheduler.hpp"
+
+namespace memory {
+
+using word_t = uint64_t __attribute__((may_alias));
+
+auto copy_bytes(byte_t *destination, const byte_t *source, size_t size) -> void {
+    size_t offset = 0;
+    auto destination_address = reinterpretable_t<void *>(destination).to_integer();
+    auto source_address = reinterpretable_t<void *>(source).to_integer();
+    if (destination_address % sizeof(word_t) == source_address % sizeof(word_t)) {
+        while (offset < size && (destination_address + offset) % sizeof(word_t) != 0) {
+            destination[offset] = source[offset];
+            offset += 1;
+        }
+        for (; offset + 4 * sizeof(word_t) <= size; offset += 4 * sizeof(word_t)) {
+            const auto *source_words = reinterpret_cast<const word_t *>(source + offset);
+            auto *destination_words = reinterpret_cast<word_t *>(destination + offset);
+            auto first = source_words[0];
+            auto second = source_words[1];
+            auto third = source_words[2];
+            auto fourth = source_words[3];
+            destination_words[0] = first;
+            destination_words[1] = second;
+            destination_words[2] = third;
+            destination_words[3] = fourth;
+        }
+        for (; offset + sizeof(word_t) <= size; offset += sizeof(word_t)) {
+            *reinterpret_cast<word_t *>(destination + offset) = *reinterpret_cast<const word_t *>(source + offset);
+        }
+    }
+    for (; offset < size; offset++) {
+        destination[offset] = source[offset];
+    }
+}
+
+auto is_user_range(uintptr_t address, size_t size) -> bool {
+    return address + size >= address && address + size <= user_address_space_constants::stack_top;
+}
+
+auto get_kernel_address(uintptr_t physical_address) -> byte_t * {
+    return reinterpret_cast<byte_t *>(kernel_address_space_constants::virtual_address_begin + physical_address);
+}
+
+// Walks the user range in batches of physically contiguous chunks and, if allowed, faults in a page whenever the walk
+// stops early
+auto copy_user_range(page_table_t *level_0_page_table, uintptr_t address, span_t<byte_t> buffer,
+                     bool is_written_by_kernel, bool may_resolve_page_faults) -> bool {
+    if (buffer.size() == 0) {
+        return true;
+    }
+    if (level_0_page_table == nullptr || !is_user_range(address, buffer.size())) {
+        return false;
+    }
+    array_t<physical_range_t, user_memory_constants::maximum_number_of_ranges_per_walk> ranges{};
+    auto ranges_span = span_t(&ranges[0], user_memory_constants::maximum_number_of_ranges_per_walk);
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        auto number_of_ranges = level_0_page_table->translate_range(address + offset, buffer.size() - offset,
+                                                                    ranges_span, is_written_by_kernel);
+        if (number_of_ranges == 0) {
+            if (!may_resolve_page_faults ||
+                !process::thread_scheduler::get().resolve_page_fault(level_0_page_table, address + offset)) {
+                return false;
+            }
+            number_of_ranges = level_0_page_table->translate_range(address + offset, buffer.size() - offset,
+                                                                   ranges_span, is_written_by_kernel);
+            if (number_of_ranges == 0) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < number_of_ranges; i++) {
+            auto *kernel_address = get_kernel_address(ranges[i].address);
+            if (is_written_by_kernel) {
+                copy_bytes(kernel_address, &buffer[offset], ranges[i].size);
+            } else {
+                copy_bytes(&buffer[offset], kernel_address, ranges[i].size);
+            }
+            offset += ranges[i].size;
+        }
+    }
+    return true;
+}
+
+auto copy_from_user(page_table_t *level_0_page_table, span_t<byte_t> destination, uintptr_t source_address) -> bool {
+    return copy_user_range(level_0_page_table, source_address, destination, false, true);
+}
+
+auto copy_to_user(page_table_t *level_0_page_table, uintptr_t destination_address, span_t<byte_t> source) -> bool {
+    return copy_user_range(level_0_page_table, destination_address, source, true, true);
+}
+
+auto copy_string_from_user(page_table_t *level_0_page_table, span_t<byte_t> destination, uintptr_t source_address)
+    -> bool {
+    if (destination.size() == 0) {
+        return false;
+    }
+    size_t offset = 0;
+    while (offset < destination.size()) {
+        auto chunk_size = page_size - (source_address + offset) % page_size;
+        if (chunk_size > destination.size() - offset) {
+            chunk_size = destination.size() - offset;
+        }
+        auto chunk = span_t(&destination[offset], chunk_size);
+        if (!copy_from_user(level_0_page_table, chunk, source_address + offset)) {
+            return false;
+        }
+        for (size_t i = 0; i < chunk_size; i++) {
+            if (chunk[i].is_zero()) {
+                return true;
+            }
+        }
+        offset += chunk_size;
+    }
+    destination[destination.size() - 1].set_value(0);
+    return true;
+}
+
+auto fault_in_user_range(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel)
+    -> bool {
+    if (size == 0) {
+        return true;
+    }
+    if (level_0_page_table == nullptr || !is_user_range(address, size)) {
+        return false;
+    }
+    physical_range_t range{};
+    for (auto page_address = address & ~(page_size - 1); page_address < address + size; page_address += page_size) {
+        auto number_of_ranges =
+            level_0_page_table->translate_range(page_address, page_size, span_t(&range, 1), is_written_by_kernel);
+        if (number_of_ranges == 0 &&
+            !process::thread_scheduler::get().resolve_page_fault(level_0_page_table, page_address)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto acquire_user_buffer(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel)
+    -> user_buffer_t {
+    return acquire_user_buffer(level_0_page_table, address, size, is_written_by_kernel, true);
+}
+
+auto acquire_user_buffer(page_table_t *level_0_page_table, uintptr_t address, size_t size, bool is_written_by_kernel,
+                         bool may_resolve_page_faults) -> user_buffer_t {
+    if (size == 0) {
+        return {address, span_t<byte_t>{}, false};
+    }
+    if (level_0_page_table == nullptr || !is_user_range(address, size)) {
+        return {};
+    }
+    physical_range_t range{};
+    if (level_0_page_table->translate_range(address, size, span_t(&range, 1), is_written_by_kernel) == 1 &&
+        range.size == size) {
+        return {address, span_t(get_kernel_address(range.address), size), false};
+    }
+    auto order = 0;
+    while (order < user_memory_constants::maximum_copy_order && (page_size << order) < size) {
+        order += 1;
+    }
+    auto copy = buddy_allocator::get().allocate(order);
+    auto copy_size = size < copy.size() ? size : copy.size();
+    if (!is_written_by_kernel && !copy_user_range(level_0_page_table, address, span_t(copy.data(), copy_size), false,
+                                                  may_resolve_page_faults)) {
+        buddy_allocator::get().deallocate(copy.data());
+        return {};
+    }
+    return {address, span_t(copy.data(), copy_size), true};
+}
+
+auto release_user_buffer(page_table_t *level_0_page_table, user_buffer_t buffer, size_t number_of_bytes_written)
+    -> bool {
+    return release_user_buffer(level_0_page_table, buffer, number_of_bytes_written, true);
+}
+
+auto release_user_buffer(page_table_t *level_0_page_table, user_buffer_t buffer, size_t number_of_bytes_written,
+                         bool may_resolve_page_faults) -> bool {
+    if (!buffer.is_copy) {
+        return true;
+    }
+    if (number_of_bytes_written > buffer.kernel_span.size()) {
+        number_of_bytes_written = buffer.kernel_span.size();
+    }
+    auto success = copy_user_range(level_0_page_table, buffer.address,
+                                   span_t(buffer.kernel_span.data(), number_of_bytes_written), true,
+                                   may_resolve_page_faults);
+    buddy_allocator::get().deallocate(buffer.kernel_span.data());
+    return success;
+}
+
+} // namespace memory
@@ -1,6 +1,7 @@
 #include "../include/virtual_memory.hpp"
 #include "../include/architecture.hpp"
 #include "../include/buddy_allocator.hpp"
+#include "../include/device_tree.hpp"
 #include "../include/multiprocessing.hpp"
 #include "../include/thread_scheduler.hpp"
 
@@ -60,12 +61,35 @@ void virtual_memory::initialize() {
         auto data_physical_address = data_virtual_address - kernel_address_space_constants::virtual_address_begin;
         auto data_size_in_bytes = kernel_address_space_constants::virtual_address_begin +
                                   kernel_address_space_constants::physical_address_begin +
-                                  kernel_address_space_constants::physical_address_space_size - text_end;
+                                  kernel_address_space_constants::minimum_physical_address_space_size - text_end;
         level_0_page_table.map(data_virtual_address, page_table_t::type_t::data, data_physical_address,
                                data_size_in_bytes);
+
+        auto device_tree_physical_address = device::device_tree::get_physical_address() & ~(section_size - 1);
+        if (device_tree_physical_address < kernel_address_space_constants::physical_address_begin ||
+            device_tree_physical_address >= kernel_address_space_constants::physical_address_begin +
+                                                kernel_address_space_constants::minimum_physical_address_space_size) {
+            level_0_page_table.map(kernel_address_space_constants::virtual_address_begin + device_tree_physical_address,
+                                   page_table_t::type_t::data, device_tree_physical_address,
+                                   device::device_tree_window_size);
+        }
     }
     virtual_memory::set_translation_table_base_1_register(&virtual_memory::get().page_tables[0]);
     virtual_memory::flush_translation_lookaside_buffer();
+
+    if (architecture::get_core_number() == 0) {
+        device::device_tree::initialize();
+        auto memory_size = device::device_tree::get().get_memory_size();
+        if (memory_size > kernel_address_space_constants::minimum_physical_address_space_size) {
+            auto remaining_physical_address = kernel_address_space_constants::physical_address_begin +
+                                              kernel_address_space_constants::minimum_physical_address_space_size;
+            virtual_memory::get().page_tables[0].map(
+                kernel_address_space_constants::virtual_address_begin + remaining_physical_address,
+                page_table_t::type_t::data, remaining_physical_address,
+                memory_size - kernel_address_space_constants::minimum_physical_address_space_size);
+            virtual_memory::flush_translation_lookaside_buffer();
+        }
+    }
 }
 
 auto virtual_memory::get_address_of_kernel_page_table() -> page_table_t * {
@@ -78,12 +102,63 @@ auto virtual_memory::allocate_new_exception_level_1_page_table() -> page_table_t
     return temp;
 }
 
+auto virtual_memory::switch_address_space(page_table_t *level_0_page_table_address) -> void {
+    auto core_number = architecture::get_core_number();
+    this->address_space_identifier_lock.acquire();
+    auto address_space_identifier = this->find_address_space_identifier(level_0_page_table_address);
+    if (address_space_identifier == 0) {
+        if (this->next_address_space_identifier == virtual_memory_constants::number_of_address_space_identifiers) {
+            for (auto &owner : this->address_space_identifier_owners) {
+                owner = nullptr;
+            }
+            for (auto &is_flush_pending : this->is_local_flush_pending) {
+                is_flush_pending = true;
+            }
+            this->next_address_space_identifier = 1;
+        }
+        address_space_identifier = this->next_address_space_identifier;
+        this->address_space_identifier_owners[address_space_identifier] = level_0_page_table_address;
+        this->next_address_space_identifier += 1;
+    }
+    auto is_flush_pending = this->is_local_flush_pending[core_number];
+    this->is_local_flush_pending[core_number] = false;
+    this->address_space_identifier_lock.release();
+
+    virtual_memory::set_translation_table_base_0_register(level_0_page_table_address, address_space_identifier);
+    if (is_flush_pending) {
+        virtual_memory::flush_local_translation_lookaside_buffer();
+    }
+}
+
+// Released identifiers are not handed out again until the next rollover, when every core flushes its TLB
+auto virtual_memory::release_address_space(page_table_t *level_0_page_table_address) -> void {
+    this->address_space_identifier_lock.acquire();
+    auto address_space_identifier = this->find_address_space_identifier(level_0_page_table_address);
+    if (address_space_identifier != 0) {
+        this->address_space_identifier_owners[address_space_identifier] = nullptr;
+    }
+    this->address_space_identifier_lock.release();
+}
+
+auto virtual_memory::find_address_space_identifier(page_table_t *level_0_page_table_address) -> uint64_t {
+    for (uint64_t i = 1; i < this->next_address_space_identifier; i++) {
+        if (this->address_space_identifier_owners[i] == level_0_page_table_address) {
+            return i;
+        }
+    }
+    return 0;
+}
+
 void virtual_memory::set_translation_table_base_1_register(page_table_t *level_0_page_table_address) {
     asm volatile("msr ttbr1_el1, %0" ::"r"(level_0_page_table_address));
 }
 
-void virtual_memory::set_translation_table_base_0_register(page_table_t *level_0_page_table_address) {
-    asm volatile("msr ttbr0_el1, %0" ::"r"(level_0_page_table_address));
+void virtual_memory::set_translation_table_base_0_register(page_table_t *level_0_page_table_address,
+                                                           uint64_t address_space_identifier) {
+    auto value = reinterpretable_t<void *>(level_0_page_table_address).to_integer() |
+                 (address_space_identifier << virtual_memory_constants::address_space_identifier_offset);
+    asm volatile("msr ttbr0_el1, %0" ::"r"(value));
+    asm volatile("isb");
 }
 
 void virtual_memory::flush_translation_lookaside_buffer() {
@@ -93,4 +168,45 @@ void virtual_memory::flush_translation_lookaside_buffer() {
     asm volatile("isb");
 }
 
+void virtual_memory::flush_translation_lookaside_buffer(page_table_t *level_0_page_table_address) {
+    virtual_memory::get().address_space_identifier_lock.acquire();
+    auto address_space_identifier = virtual_memory::get().find_address_space_identifier(level_0_page_table_address);
+    virtual_memory::get().address_space_identifier_lock.release();
+    if (address_space_identifier == 0) {
+        virtual_memory::flush_translation_lookaside_buffer();
+        return;
+    }
+    auto value = address_space_identifier << virtual_memory_constants::address_space_identifier_offset;
+    asm volatile("dsb ishst");
+    asm volatile("tlbi aside1is, %0" ::"r"(value));
+    asm volatile("dsb ish");
+    asm volatile("isb");
+}
+
+void virtual_memory::flush_translation_lookaside_buffer(page_table_t *level_0_page_table_address,
+                                                        uintptr_t virtual_address) {
+    virtual_memory::get().address_space_identifier_lock.acquire();
+    auto address_space_identifier = virtual_memory::get().find_address_space_identifier(level_0_page_table_address);
+    virtual_memory::get().address_space_identifier_lock.release();
+    if (address_space_identifier == 0) {
+        virtual_memory::flush_translation_lookaside_buffer();
+        return;
+    }
+    auto page_number =
+        virtual_address >> virtual_memory_constants::virtual_address_field_offset::level_3_page_table_index;
+    auto value = (address_space_identifier << virtual_memory_constants::address_space_identifier_offset) |
+                 (page_number & virtual_memory_constants::translation_lookaside_buffer_page_mask);
+    asm volatile("dsb ishst");
+    asm volatile("tlbi vae1is, %0" ::"r"(value));
+    asm volatile("dsb ish");
+    asm volatile("isb");
+}
+
+void virtual_memory::flush_local_translation_lookaside_buffer() {
+    asm volatile("dsb nshst");
+    asm volatile("tlbi vmalle1");
+    asm volatile("dsb nsh");
+    asm volatile("isb");
+}
+
 } // namespace memory
@@ -0,0 +1,85 @@
+#include "system_calls.h"
+
+#define page_size 4096
+#define maximum_number_of_pages 64
+#define number_of_round_trips 256
+
+char working_set[maximum_number_of_pages * page_size];
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+void touch_working_set(int number_of_pages) {
+    for (int i = 0; i < number_of_pages; i++) {
+        working_set[i * page_size] += 1;
+    }
+}
+
+void measure(int number_of_pages) {
+    int requests[2];
+    int responses[2];
+    if (!pipe(requests) || !pipe(responses)) {
+        print("context_switch_benchmark: unable to create pipe\n");
+        exit(0);
+    }
+    touch_working_set(number_of_pages);
+    char token = 'x';
+    if (fork() == 0) {
+        close(requests[1]);
+        close(responses[0]);
+        touch_working_set(number_of_pages);
+        for (int i = 0; i < number_of_round_trips; i++) {
+            read(requests[0], &token, 1);
+            touch_working_set(number_of_pages);
+            write(responses[1], &token, 1);
+        }
+        exit(0);
+    }
+    close(requests[0]);
+    close(responses[1]);
+
+    uint64_t begin = time();
+    for (int i = 0; i < number_of_round_trips; i++) {
+        write(requests[1], &token, 1);
+        read(responses[0], &token, 1);
+        touch_working_set(number_of_pages);
+    }
+    uint64_t end = time();
+    close(requests[1]);
+    close(responses[0]);
+    wait();
+
+    print_number(number_of_pages);
+    print(" pages: ");
+    print_number((end - begin) / number_of_round_trips);
+    print(" us per round trip\n");
+}
+
+int main(int argc, char *argv[]) {
+    for (int number_of_pages = 1; number_of_pages <= maximum_number_of_pages; number_of_pages *= 4) {
+        measure(number_of_pages);
+    }
+    exit(0);
+}
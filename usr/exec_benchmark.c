@@ -0,0 +1,56 @@
+#include "system_calls.h"
+
+#define number_of_execs 16
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+void measure(char *path) {
+    char *arguments[2] = {path, 0};
+    uint64_t begin = time();
+    for (int i = 0; i < number_of_execs; i++) {
+        if (fork() == 0) {
+            exec(path, arguments);
+            print("exec_benchmark: unable to execute ");
+            print(path);
+            print("\n");
+            exit(0);
+        }
+        wait();
+    }
+    uint64_t end = time();
+
+    print(path);
+    print(": ");
+    print_number((end - begin) / number_of_execs);
+    print(" us per fork, exec, exit and wait\n");
+}
+
+int main(int argc, char *argv[]) {
+    measure("exec_target_small");
+    measure("exec_target_medium");
+    measure("exec_target_large");
+    exit(0);
+}
@@ -0,0 +1,16 @@
+#include "system_calls.h"
+
+#ifndef padding_size
+#define padding_size 1
+#endif
+
+#ifndef zero_size
+#define zero_size 1
+#endif
+
+const char padding[padding_size] = {1};
+char zeroes[zero_size];
+
+int main(int argc, char *argv[]) {
+    exit(padding[argc] + zeroes[argc]);
+}
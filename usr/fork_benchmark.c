@@ -0,0 +1,94 @@
+#include "system_calls.h"
+
+#define number_of_forks 64
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t begin = time();
+    for (int i = 0; i < number_of_forks; i++) {
+        if (fork() == 0) {
+            exit(0);
+        }
+        wait();
+    }
+    uint64_t end = time();
+
+    print("fork: ");
+    print_number((end - begin) / number_of_forks);
+    print(" us per fork, exit and wait\n");
+
+    begin = time();
+    for (int i = 0; i < number_of_forks; i++) {
+        if (vfork() == 0) {
+            exit(0);
+        }
+        wait();
+    }
+    end = time();
+
+    print("vfork: ");
+    print_number((end - begin) / number_of_forks);
+    print(" us per vfork, exit and wait\n");
+
+    char *arguments[2] = {"exec_target_small", 0};
+    begin = time();
+    for (int i = 0; i < number_of_forks; i++) {
+        if (spawn(arguments[0], arguments, 0, 0) == -1) {
+            print("fork_benchmark: unable to spawn exec_target_small\n");
+            break;
+        }
+        wait();
+    }
+    end = time();
+
+    print("spawn: ");
+    print_number((end - begin) / number_of_forks);
+    print(" us per spawn, exit and wait\n");
+
+    int file_descriptors[2];
+    if (!pipe(file_descriptors)) {
+        print("fork_benchmark: unable to create pipe\n");
+        exit(0);
+    }
+    size_t free_memory_before_fork = free_memory();
+    if (fork() == 0) {
+        char character;
+        close(file_descriptors[1]);
+        read(file_descriptors[0], &character, 1);
+        exit(0);
+    }
+    size_t free_memory_after_fork = free_memory();
+    close(file_descriptors[1]);
+    close(file_descriptors[0]);
+    wait();
+
+    print("child: ");
+    print_number(free_memory_before_fork - free_memory_after_fork);
+    print(" bytes\n");
+    print_kernel_allocator_statistics();
+    exit(0);
+}
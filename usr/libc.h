@@ -1,6 +1,12 @@
 #ifndef LIBC_H
 #define LIBC_H
 
+#include "system_calls.h"
+
+#define MALLOC_ALIGNMENT 16
+#define MALLOC_MAPPED 0x1
+#define MALLOC_MAPPING_THRESHOLD (64 * 1024)
+
 void *memset(void *dst, int c, unsigned long n) {
     char *cdst = (char *)dst;
     int i;
@@ -10,4 +16,114 @@ void *memset(void *dst, int c, unsigned long n) {
     return dst;
 }
 
+void *memcpy(void *dst, const void *src, unsigned long n) {
+    char *cdst = (char *)dst;
+    const char *csrc = (const char *)src;
+    for (unsigned long i = 0; i < n; i++) {
+        cdst[i] = csrc[i];
+    }
+    return dst;
+}
+
+struct malloc_block {
+    size_t size;
+    struct malloc_block *next;
+};
+
+struct malloc_block *malloc_free_list = 0;
+
+void *malloc(size_t size) {
+    size = (size + sizeof(struct malloc_block) + MALLOC_ALIGNMENT - 1) & ~(size_t)(MALLOC_ALIGNMENT - 1);
+    if (size >= MALLOC_MAPPING_THRESHOLD) {
+        struct malloc_block *block = mmap(0, size, MAP_ANONYMOUS | MAP_WRITABLE, -1, 0);
+        if (block == MAP_FAILED) {
+            return 0;
+        }
+        block->size = size | MALLOC_MAPPED;
+        return block + 1;
+    }
+    struct malloc_block **link = &malloc_free_list;
+    while (*link != 0) {
+        struct malloc_block *block = *link;
+        if (block->size >= size) {
+            if (block->size - size >= 2 * sizeof(struct malloc_block)) {
+                struct malloc_block *remainder = (struct malloc_block *)((char *)block + size);
+                remainder->size = block->size - size;
+                remainder->next = block->next;
+                *link = remainder;
+                block->size = size;
+            } else {
+                *link = block->next;
+            }
+            return block + 1;
+        }
+        link = &block->next;
+    }
+    struct malloc_block *block = sbrk(size);
+    if (block == MAP_FAILED) {
+        return 0;
+    }
+    block->size = size;
+    return block + 1;
+}
+
+void free(void *pointer) {
+    if (pointer == 0) {
+        return;
+    }
+    struct malloc_block *block = (struct malloc_block *)pointer - 1;
+    if (block->size & MALLOC_MAPPED) {
+        munmap(block, block->size & ~(size_t)MALLOC_MAPPED);
+        return;
+    }
+    struct malloc_block *previous = 0;
+    struct malloc_block *next = malloc_free_list;
+    while (next != 0 && next < block) {
+        previous = next;
+        next = next->next;
+    }
+    if (next != 0 && (char *)block + block->size == (char *)next) {
+        block->size += next->size;
+        block->next = next->next;
+    } else {
+        block->next = next;
+    }
+    if (previous != 0 && (char *)previous + previous->size == (char *)block) {
+        previous->size += block->size;
+        previous->next = block->next;
+    } else if (previous != 0) {
+        previous->next = block;
+    } else {
+        malloc_free_list = block;
+    }
+}
+
+void *calloc(size_t number, size_t size) {
+    if (size != 0 && number > (size_t)-1 / size) {
+        return 0;
+    }
+    void *pointer = malloc(number * size);
+    if (pointer != 0) {
+        memset(pointer, 0, number * size);
+    }
+    return pointer;
+}
+
+void *realloc(void *pointer, size_t size) {
+    if (pointer == 0) {
+        return malloc(size);
+    }
+    struct malloc_block *block = (struct malloc_block *)pointer - 1;
+    size_t capacity = (block->size & ~(size_t)MALLOC_MAPPED) - sizeof(struct malloc_block);
+    if (size <= capacity) {
+        return pointer;
+    }
+    void *new_pointer = malloc(size);
+    if (new_pointer != 0) {
+        memcpy(new_pointer, pointer, capacity);
+        free(pointer);
+    }
+    return new_pointer;
+}
+
 #endif
@@ -0,0 +1,86 @@
+#include "system_calls.h"
+
+#define page_size 4096
+#define maximum_number_of_workers 4
+#define number_of_pages_per_mapping 16
+#define number_of_mappings_per_worker 256
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+void allocate_and_free_pages() {
+    for (int i = 0; i < number_of_mappings_per_worker; i++) {
+        char *mapping = mmap(0, number_of_pages_per_mapping * page_size, MAP_ANONYMOUS | MAP_WRITABLE, -1, 0);
+        if (mapping == MAP_FAILED) {
+            print("page_allocation_benchmark: unable to map pages\n");
+            exit(0);
+        }
+        for (int j = 0; j < number_of_pages_per_mapping; j++) {
+            mapping[j * page_size] = 1;
+        }
+        munmap(mapping, number_of_pages_per_mapping * page_size);
+    }
+}
+
+void measure(int number_of_workers) {
+    int start[2];
+    if (!pipe(start)) {
+        print("page_allocation_benchmark: unable to create pipe\n");
+        exit(0);
+    }
+    for (int i = 0; i < number_of_workers; i++) {
+        if (fork() == 0) {
+            char token;
+            close(start[1]);
+            read(start[0], &token, 1);
+            allocate_and_free_pages();
+            exit(0);
+        }
+    }
+    close(start[0]);
+
+    char tokens[maximum_number_of_workers] = {0};
+    uint64_t begin = time();
+    write(start[1], tokens, number_of_workers);
+    for (int i = 0; i < number_of_workers; i++) {
+        wait();
+    }
+    uint64_t end = time();
+    close(start[1]);
+
+    uint64_t number_of_pages =
+        (uint64_t)number_of_workers * number_of_mappings_per_worker * number_of_pages_per_mapping;
+    print_number(number_of_workers);
+    print(" workers: ");
+    print_number(number_of_pages * 1000 / (end - begin + 1));
+    print(" pages per ms\n");
+}
+
+int main(int argc, char *argv[]) {
+    for (int number_of_workers = 1; number_of_workers <= maximum_number_of_workers; number_of_workers++) {
+        measure(number_of_workers);
+    }
+    exit(0);
+}
@@ -0,0 +1,91 @@
+#include "libc.h"
+#include "system_calls.h"
+
+#define buffer_size 4096
+#define number_of_buffers 256
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+uint64_t parse_number(char *string) {
+    uint64_t value = 0;
+    while (*string >= '0' && *string <= '9') {
+        value = value * 10 + (*string - '0');
+        string++;
+    }
+    return value;
+}
+
+int main(int argc, char *argv[]) {
+    int file_descriptors[2];
+    if (!pipe(file_descriptors)) {
+        print("pipe_benchmark: unable to create pipe\n");
+        exit(0);
+    }
+    if (argc > 1) {
+        size_t capacity = resize_pipe(file_descriptors[1], parse_number(argv[1]));
+        if (capacity == 0) {
+            print("pipe_benchmark: unable to resize pipe\n");
+            exit(0);
+        }
+        print("capacity: ");
+        print_number(capacity);
+        print(" bytes\n");
+    }
+
+    char data[buffer_size];
+    memset(data, 'x', buffer_size);
+
+    if (fork() == 0) {
+        close(file_descriptors[0]);
+        for (int i = 0; i < number_of_buffers; i++) {
+            write(file_descriptors[1], data, buffer_size);
+        }
+        close(file_descriptors[1]);
+        exit(0);
+    }
+
+    close(file_descriptors[1]);
+    uint64_t begin = time();
+    uint64_t total = 0;
+    size_t number_of_bytes_read = 0;
+    while ((number_of_bytes_read = read(file_descriptors[0], data, buffer_size)) != 0) {
+        total += number_of_bytes_read;
+    }
+    uint64_t end = time();
+    wait();
+
+    print("transferred: ");
+    print_number(total);
+    print(" bytes in ");
+    print_number(end - begin);
+    print(" us\n");
+    if (end > begin) {
+        print("bandwidth: ");
+        print_number(total / (end - begin));
+        print(" MB/s\n");
+    }
+    exit(0);
+}
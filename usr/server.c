@@ -18,22 +18,49 @@ int main() {
         print("ERROR: listen() failed\n");
         exit(0);
     }
+    set_non_blocking(sckt, 1);
+    int event_set = create_event_set();
+    if (event_set == -1 || !control_event_set(event_set, sckt, EVENT_SET_ADD, POLL_READABLE)) {
+        print("ERROR: create_event_set() failed\n");
+        exit(0);
+    }
     print("LISTENING...\n");
-    int conn = accept(sckt);
-    while (conn != -1) {
-        for (;;) {
+    for (;;) {
+        struct poll_descriptor events[8] = {};
+        size_t number_of_events = wait_event_set(event_set, events, 8, 1);
+        for (size_t i = 0; i < number_of_events; i++) {
+            int file_descriptor = events[i].file_descriptor;
+            if (file_descriptor == sckt) {
+                int conn = accept(sckt);
+                if (conn == -2) {
+                    continue;
+                }
+                if (conn == -1) {
+                    print("ERROR: accept() failed\n");
+                    continue;
+                }
+                if (!control_event_set(event_set, conn, EVENT_SET_ADD, POLL_READABLE)) {
+                    print("ERROR: control_event_set() failed\n");
+                    close(conn);
+                }
+                continue;
+            }
             char data[64] = {};
-            if (read(conn, data, 64) == 0) {
-                break;
+            size_t size = 0;
+            if ((events[i].returned_events & POLL_READABLE) != 0) {
+                size = read(file_descriptor, data, 63);
+            }
+            if (size == WOULD_BLOCK) {
+                continue;
+            }
+            if (size == 0) {
+                control_event_set(event_set, file_descriptor, EVENT_SET_REMOVE, 0);
+                close(file_descriptor);
+                continue;
             }
             print("DATA: ");
             print(data);
             print("\n");
         }
-        close(conn);
-        conn = accept(sckt);
     }
-    print("ERROR: accept() failed\n");
-    close(sckt);
-    exit(0);
 }
@@ -0,0 +1,131 @@
+#include "libc.h"
+#include "system_calls.h"
+
+#define buffer_size 4096
+#define number_of_buffers 4096
+#define ring_size (64 * 1024)
+
+struct shared_ring {
+    uint64_t head;
+    uint64_t padding[7];
+    uint64_t tail;
+    char data[ring_size];
+};
+
+void write_character(char character) {
+    write(1, &character, 1);
+}
+
+void print(char *string) {
+    while (*string != '\0') {
+        write_character(*string);
+        string++;
+    }
+}
+
+void print_number(uint64_t value) {
+    char digits[20];
+    int index = 0;
+    do {
+        digits[index] = '0' + value % 10;
+        value /= 10;
+        index += 1;
+    } while (value != 0);
+    while (index > 0) {
+        index -= 1;
+        write_character(digits[index]);
+    }
+}
+
+void print_result(char *name, uint64_t total, uint64_t begin, uint64_t end) {
+    print(name);
+    print(": ");
+    print_number(total);
+    print(" bytes in ");
+    print_number(end - begin);
+    print(" us");
+    if (end > begin) {
+        print(", ");
+        print_number(total / (end - begin));
+        print(" MB/s");
+    }
+    print("\n");
+}
+
+void produce(struct shared_ring *ring, char *data) {
+    for (int i = 0; i < number_of_buffers; i++) {
+        uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+        while (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) > ring_size - buffer_size) {
+            yield();
+        }
+        memcpy(&ring->data[tail % ring_size], data, buffer_size);
+        __atomic_store_n(&ring->tail, tail + buffer_size, __ATOMIC_RELEASE);
+    }
+}
+
+uint64_t consume(struct shared_ring *ring, char *data) {
+    uint64_t total = 0;
+    while (total < (uint64_t)number_of_buffers * buffer_size) {
+        uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        while (__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+            yield();
+        }
+        memcpy(data, &ring->data[head % ring_size], buffer_size);
+        __atomic_store_n(&ring->head, head + buffer_size, __ATOMIC_RELEASE);
+        total += buffer_size;
+    }
+    return total;
+}
+
+int main(int argc, char *argv[]) {
+    char data[buffer_size];
+    memset(data, 'x', buffer_size);
+
+    int shared_memory = create_shared_memory(sizeof(struct shared_ring));
+    if (shared_memory == -1) {
+        print("shared_memory_benchmark: unable to create shared memory\n");
+        exit(0);
+    }
+    struct shared_ring *ring = mmap(0, sizeof(struct shared_ring), MAP_SHARED | MAP_WRITABLE, shared_memory, 0);
+    close(shared_memory);
+    if (ring == MAP_FAILED) {
+        print("shared_memory_benchmark: unable to map shared memory\n");
+        exit(0);
+    }
+    if (fork() == 0) {
+        produce(ring, data);
+        exit(0);
+    }
+    uint64_t begin = time();
+    uint64_t total = consume(ring, data);
+    uint64_t end = time();
+    wait();
+    munmap(ring, sizeof(struct shared_ring));
+    print_result("shared memory", total, begin, end);
+
+    int file_descriptors[2];
+    if (!pipe(file_descriptors)) {
+        print("shared_memory_benchmark: unable to create pipe\n");
+        exit(0);
+    }
+    if (fork() == 0) {
+        close(file_descriptors[0]);
+        for (int i = 0; i < number_of_buffers; i++) {
+            write(file_descriptors[1], data, buffer_size);
+        }
+        close(file_descriptors[1]);
+        exit(0);
+    }
+    close(file_descriptors[1]);
+    begin = time();
+    total = 0;
+    size_t number_of_bytes_read = 0;
+    while ((number_of_bytes_read = read(file_descriptors[0], data, buffer_size)) != 0) {
+        total += number_of_bytes_read;
+    }
+    end = time();
+    close(file_descriptors[0]);
+    wait();
+    print_result("pipe", total, begin, end);
+    exit(0);
+}
@@ -19,14 +19,13 @@ void print(char *string) {
 }
 
 void handle_command_execution(char *command) {
-    char arguments[64][64];
+    char(*arguments)[64] = calloc(64, 64);
     int argument_index = 0;
     int argument_character_index = 0;
 
-    for (int i = 0; i < 64; i++) {
-        for (int j = 0; j < 64; j++) {
-            arguments[i][j] = '\0';
-        }
+    if (arguments == 0) {
+        print("shell: out of memory\n");
+        return;
     }
 
     for (int i = 0; i < 256; i++) {
@@ -42,6 +41,7 @@ void handle_command_execution(char *command) {
     }
 
     if (argument_index < 1) {
+        free(arguments);
         return;
     }
 
@@ -50,7 +50,7 @@ void handle_command_execution(char *command) {
         arguments_list[i] = 0;
     }
     for (int i = 0; i < argument_index; i++) {
-        arguments_list[i] = (char *)&arguments[i];
+        arguments_list[i] = arguments[i];
     }
 
     int parent_to_child[2];
@@ -58,28 +58,25 @@ void handle_command_execution(char *command) {
     int child_to_parent[2];
     pipe(child_to_parent);
 
-    if (fork() == 0) {
-        // child
-        close(0);
-        close(1);
-        close(parent_to_child[1]);
-        close(child_to_parent[0]);
-        int new_stdin = copy(parent_to_child[0]);
-        int new_stdout = copy(child_to_parent[1]);
-        exec(arguments[0], arguments_list);
-        exit(0);
+    int file_descriptor_map[2] = {parent_to_child[0], child_to_parent[1]};
+    int child = spawn(arguments[0], arguments_list, file_descriptor_map, 2);
+    close(parent_to_child[0]);
+    close(child_to_parent[1]);
+    if (child == -1) {
+        print("shell: unable to execute ");
+        print(arguments[0]);
+        print("\n");
     } else {
-        // parent
-        close(parent_to_child[0]);
-        close(child_to_parent[1]);
-        char character_from_child = 1;
-        while (character_from_child != 0) {
-            if (read(child_to_parent[0], &character_from_child, 1) != 0) {
-                write(1, &character_from_child, 1);
-            }
+        char data_from_child[64];
+        size_t number_of_bytes_from_child = 0;
+        while ((number_of_bytes_from_child = read(child_to_parent[0], data_from_child, 64)) != 0) {
+            write(1, data_from_child, number_of_bytes_from_child);
         }
         wait();
     }
+    close(parent_to_child[1]);
+    close(child_to_parent[0]);
+    free(arguments);
 }
 
 int main() {
@@ -4,25 +4,122 @@
 #include <stddef.h>
 #include <stdint.h>
 
+struct io_vector {
+    void *data;
+    size_t size;
+};
+
+struct poll_descriptor {
+    int file_descriptor;
+    uint16_t requested_events;
+    uint16_t returned_events;
+};
+
+#define POLL_READABLE 0x1
+#define POLL_WRITABLE 0x2
+#define POLL_CLOSED 0x4
+#define POLL_INVALID 0x8
+#define POLL_EDGE_TRIGGERED 0x100
+
+#define EVENT_SET_ADD 1
+#define EVENT_SET_MODIFY 2
+#define EVENT_SET_REMOVE 3
+
+#define WOULD_BLOCK ((size_t)-2)
+
+#define MAP_ANONYMOUS 0x1
+#define MAP_SHARED 0x2
+#define MAP_WRITABLE 0x4
+#define MAP_FAILED ((void *)-1)
+
+#define RING_ENTRIES 256
+#define RING_POLLING 0x1
+
+#define RING_NONE 0
+#define RING_READ 1
+#define RING_WRITE 2
+#define RING_SEND 3
+#define RING_RECEIVE 4
+#define RING_ACCEPT 5
+#define RING_SYNCHRONIZE 6
+
+struct ring_header {
+    uint32_t submission_head;
+    uint32_t submission_tail;
+    uint32_t completion_head;
+    uint32_t completion_tail;
+    uint32_t number_of_entries;
+    uint32_t flags;
+    uint64_t reserved;
+};
+
+struct submission_entry {
+    uint8_t operation;
+    uint8_t reserved[3];
+    int file_descriptor;
+    void *address;
+    size_t size;
+    size_t offset;
+    uint64_t user_data;
+};
+
+struct completion_entry {
+    uint64_t user_data;
+    int64_t result;
+};
+
+struct ring {
+    struct ring_header header;
+    struct submission_entry submission_entries[RING_ENTRIES];
+    struct completion_entry completion_entries[RING_ENTRIES];
+};
+
 // file system
 int open(char *, int, int, int);
 void close(int);
 int copy(int);
 size_t read(int, void *, size_t);
 size_t write(int, void *, size_t);
+size_t read_at(int, void *, size_t, size_t);
+size_t write_at(int, void *, size_t, size_t);
+size_t read_vector(int, struct io_vector *, size_t);
+size_t write_vector(int, struct io_vector *, size_t);
+size_t poll(struct poll_descriptor *, size_t, int);
+int create_event_set();
+int control_event_set(int, int, int, uint16_t);
+size_t wait_event_set(int, struct poll_descriptor *, size_t, int);
+int set_non_blocking(int, int);
+int create_ring(int, struct ring **);
+size_t enter_ring(int, size_t);
+size_t free_memory();
+void print_kernel_allocator_statistics();
+void *brk(void *);
+void *sbrk(intptr_t);
+void *mmap(void *, size_t, int, int, size_t);
+int munmap(void *, size_t);
+int msync(void *, size_t);
+int create_shared_memory(size_t);
 
 // process management
 int fork();
+int vfork();
+int spawn(char *, char **, int *, size_t);
 int exec(char *, char **);
 int wait();
+void yield();
 void exit(int);
+uint64_t time();
 
 // inter-process communication
 int pipe(int *);
+size_t splice(int, int, size_t);
+size_t tee(int, int, size_t);
+size_t resize_pipe(int, size_t);
 
 // networking
 size_t receive(int, void *, size_t, uint32_t *, uint16_t *);
 size_t transmit(int, void *, size_t, uint32_t, uint16_t);
+size_t send_file(int, int, size_t, size_t);
 int socket(int);
 int bind(int, int);
 int connect(int, int, int);
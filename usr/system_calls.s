@@ -34,6 +34,12 @@ pipe:
     svc 0
     ret
 
+.global yield
+yield:
+    mov x8, 7
+    svc 0
+    ret
+
 .global wait
 wait:
     mov x8, 8
@@ -99,3 +105,159 @@ transmit:
     mov x8, 18
     svc 0
     ret
+
+.global read_at
+read_at:
+    mov x8, 19
+    svc 0
+    ret
+
+.global write_at
+write_at:
+    mov x8, 20
+    svc 0
+    ret
+
+.global read_vector
+read_vector:
+    mov x8, 21
+    svc 0
+    ret
+
+.global write_vector
+write_vector:
+    mov x8, 22
+    svc 0
+    ret
+
+.global send_file
+send_file:
+    mov x8, 23
+    svc 0
+    ret
+
+.global splice
+splice:
+    mov x8, 24
+    svc 0
+    ret
+
+.global tee
+tee:
+    mov x8, 25
+    svc 0
+    ret
+
+.global resize_pipe
+resize_pipe:
+    mov x8, 26
+    svc 0
+    ret
+
+.global time
+time:
+    mov x8, 27
+    svc 0
+    ret
+
+.global poll
+poll:
+    mov x8, 28
+    svc 0
+    ret
+
+.global create_event_set
+create_event_set:
+    mov x8, 29
+    svc 0
+    ret
+
+.global control_event_set
+control_event_set:
+    mov x8, 30
+    svc 0
+    ret
+
+.global wait_event_set
+wait_event_set:
+    mov x8, 31
+    svc 0
+    ret
+
+.global set_non_blocking
+set_non_blocking:
+    mov x8, 32
+    svc 0
+    ret
+
+.global create_ring
+create_ring:
+    mov x8, 33
+    svc 0
+    ret
+
+.global enter_ring
+enter_ring:
+    mov x8, 34
+    svc 0
+    ret
+
+.global free_memory
+free_memory:
+    mov x8, 35
+    svc 0
+    ret
+
+.global brk
+brk:
+    mov x8, 36
+    svc 0
+    ret
+
+.global sbrk
+sbrk:
+    mov x8, 37
+    svc 0
+    ret
+
+.global mmap
+mmap:
+    mov x8, 38
+    svc 0
+    ret
+
+.global munmap
+munmap:
+    mov x8, 39
+    svc 0
+    ret
+
+.global msync
+msync:
+    mov x8, 40
+    svc 0
+    ret
+
+.global create_shared_memory
+create_shared_memory:
+    mov x8, 41
+    svc 0
+    ret
+
+.global vfork
+vfork:
+    mov x8, 42
+    svc 0
+    ret
+
+.global spawn
+spawn:
+    mov x8, 43
+    svc 0
+    ret
+
+.global print_kernel_allocator_statistics
+print_kernel_allocator_statistics:
+    mov x8, 44
+    svc 0
+    ret